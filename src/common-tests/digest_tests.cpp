@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#include "common/md5_digest.h"
+#include "common/sha1_digest.h"
+#include "common/string_util.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string_view>
+#include <vector>
+
+static std::span<const u8> ToSpan(std::string_view str)
+{
+  return std::span<const u8>(reinterpret_cast<const u8*>(str.data()), str.size());
+}
+
+static std::string MD5String(std::span<const u8> data)
+{
+  const std::array<u8, MD5Digest::DIGEST_SIZE> digest = MD5Digest::HashData(data);
+  return StringUtil::EncodeHex(digest.data(), static_cast<int>(digest.size()));
+}
+
+static std::string SHA1String(std::span<const u8> data)
+{
+  std::array<u8, SHA1Digest::DIGEST_SIZE> digest = SHA1Digest::GetDigest(data);
+  return SHA1Digest::DigestToString(digest);
+}
+
+static std::vector<u8> GetRandomData(size_t size, u32 seed)
+{
+  std::vector<u8> data(size);
+  std::mt19937 rng(seed);
+  for (u8& byte : data)
+    byte = static_cast<u8>(rng());
+  return data;
+}
+
+// Sizes around the block and padding boundaries, plus a few multi-block lengths.
+static constexpr size_t s_random_sizes[] = {0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 1000, 4096, 65537};
+
+static std::vector<u8> GetPatternData(size_t size)
+{
+  std::vector<u8> data(size);
+  u32 seed = 0x12345678u;
+  for (u8& byte : data)
+  {
+    seed = seed * 1103515245u + 12345u;
+    byte = static_cast<u8>(seed >> 16);
+  }
+  return data;
+}
+
+TEST(MD5Digest, KnownVectors)
+{
+  ASSERT_EQ(MD5String(ToSpan("")), "d41d8cd98f00b204e9800998ecf8427e");
+  ASSERT_EQ(MD5String(ToSpan("abc")), "900150983cd24fb0d6963f7d28e17f72");
+  ASSERT_EQ(MD5String(ToSpan("message digest")), "f96b697d7cb7938d525a2f31aaf161d0");
+  ASSERT_EQ(MD5String(ToSpan("12345678901234567890123456789012345678901234567890123456789012345678901234567890")),
+            "57edf4a22be3c955ac49da2e2107b67a");
+
+  const std::vector<u8> million_a(1000000, 'a');
+  ASSERT_EQ(MD5String(million_a), "7707d6ae4e027c70eea2a935c2296f21");
+}
+
+TEST(MD5Digest, IncrementalMatchesOneShot)
+{
+  const std::vector<u8> data = GetPatternData(10000);
+  const std::string expected = MD5String(data);
+
+  // Odd chunk sizes exercise the partial block buffering and unaligned full blocks.
+  for (const size_t chunk_size : {1, 7, 63, 64, 65, 1000})
+  {
+    MD5Digest digest;
+    for (size_t pos = 0; pos < data.size(); pos += chunk_size)
+      digest.Update(std::span<const u8>(data).subspan(pos, std::min(chunk_size, data.size() - pos)));
+
+    std::array<u8, MD5Digest::DIGEST_SIZE> result;
+    digest.Final(result);
+    ASSERT_EQ(StringUtil::EncodeHex(result.data(), static_cast<int>(result.size())), expected);
+  }
+}
+
+TEST(MD5Digest, DirectBlocksMatchBuffered)
+{
+  // Full blocks are hashed straight from the caller's buffer, which may be unaligned. Feeding one byte at a time
+  // always goes through the context buffer, so the two must agree.
+  for (const size_t size : s_random_sizes)
+  {
+    const std::vector<u8> data = GetRandomData(size + 3, static_cast<u32>(size));
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+      const std::span<const u8> input = std::span<const u8>(data).subspan(offset, size);
+      const std::string direct = MD5String(input);
+
+      MD5Digest digest;
+      for (const u8 byte : input)
+        digest.Update(&byte, 1);
+
+      std::array<u8, MD5Digest::DIGEST_SIZE> result;
+      digest.Final(result);
+      ASSERT_EQ(StringUtil::EncodeHex(result.data(), static_cast<int>(result.size())), direct)
+        << "size " << size << " offset " << offset;
+    }
+  }
+}
+
+TEST(SHA1Digest, KnownVectors)
+{
+  ASSERT_EQ(SHA1String(ToSpan("")), "DA39A3EE5E6B4B0D3255BFEF95601890AFD80709");
+  ASSERT_EQ(SHA1String(ToSpan("abc")), "A9993E364706816ABA3E25717850C26C9CD0D89D");
+  ASSERT_EQ(SHA1String(ToSpan("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")),
+            "84983E441C3BD26EBAAE4AA1F95129E5E54670F1");
+
+  const std::vector<u8> million_a(1000000, 'a');
+  ASSERT_EQ(SHA1String(million_a), "34AA973CD4C4DAA4F61EEB2BDBAD27316534016F");
+}
+
+TEST(SHA1Digest, IncrementalMatchesOneShot)
+{
+  const std::vector<u8> data = GetPatternData(10000);
+  const std::string expected = SHA1String(data);
+
+  for (const size_t chunk_size : {1, 7, 63, 64, 65, 1000})
+  {
+    SHA1Digest digest;
+    for (size_t pos = 0; pos < data.size(); pos += chunk_size)
+      digest.Update(std::span<const u8>(data).subspan(pos, std::min(chunk_size, data.size() - pos)));
+
+    std::array<u8, SHA1Digest::DIGEST_SIZE> result;
+    digest.Final(result.data());
+    ASSERT_EQ(SHA1Digest::DigestToString(result), expected);
+  }
+}
+
+TEST(SHA1Digest, PortableMatchesAccelerated)
+{
+  if (!SHA1Digest::IsAccelerated())
+    GTEST_SKIP() << "Host does not support SHA instructions";
+
+  for (const size_t size : s_random_sizes)
+  {
+    const std::vector<u8> data = GetRandomData(size + 3, static_cast<u32>(size));
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+      const std::span<const u8> input = std::span<const u8>(data).subspan(offset, size);
+      const std::string accelerated = SHA1String(input);
+
+      SHA1Digest::SetAccelerationEnabled(false);
+      const std::string portable = SHA1String(input);
+      SHA1Digest::SetAccelerationEnabled(true);
+
+      ASSERT_EQ(accelerated, portable) << "size " << size << " offset " << offset;
+    }
+  }
+}
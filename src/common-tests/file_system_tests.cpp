@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: CC-BY-NC-ND-4.0
 
 #include "common/file_system.h"
+#include "common/path.h"
+
+#include "fmt/format.h"
 
 #include <gtest/gtest.h>
 
@@ -27,3 +30,37 @@ TEST(FileSystem, GetWin32Path)
 }
 
 #endif
+
+TEST(FileSystem, FindFilesParallel)
+{
+  const std::string root = Path::Combine(FileSystem::GetWorkingDirectory(), "find_files_test");
+  FileSystem::RecursiveDeleteDirectory(root.c_str());
+  for (u32 i = 0; i < 4; i++)
+  {
+    const std::string dir = Path::Combine(root, fmt::format("dir{}" FS_OSPATH_SEPARATOR_STR "sub{}", i, i));
+    ASSERT_TRUE(FileSystem::CreateDirectory(dir.c_str(), true));
+    for (u32 j = 0; j < 8; j++)
+    {
+      ASSERT_TRUE(FileSystem::WriteStringToFile(Path::Combine(dir, fmt::format("file{}.bin", j)).c_str(), "data"));
+      ASSERT_TRUE(FileSystem::WriteStringToFile(Path::Combine(dir, fmt::format("file{}.txt", j)).c_str(), "data"));
+    }
+  }
+
+  FileSystem::FindResultsArray serial_results, parallel_results;
+  ASSERT_TRUE(FileSystem::FindFiles(root.c_str(), "*.bin",
+                                    FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_SORT_BY_NAME,
+                                    &serial_results));
+  ASSERT_TRUE(FileSystem::FindFiles(root.c_str(), "*.bin",
+                                    FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_PARALLEL |
+                                      FILESYSTEM_FIND_SORT_BY_NAME,
+                                    &parallel_results));
+  FileSystem::RecursiveDeleteDirectory(root.c_str());
+
+  ASSERT_EQ(serial_results.size(), 32u);
+  ASSERT_EQ(parallel_results.size(), serial_results.size());
+  for (size_t i = 0; i < serial_results.size(); i++)
+  {
+    ASSERT_EQ(parallel_results[i].FileName, serial_results[i].FileName);
+    ASSERT_EQ(parallel_results[i].Size, 4);
+  }
+}
@@ -13,9 +13,14 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <numeric>
+#include <set>
+#include <thread>
 
 #ifdef __APPLE__
 #include <mach-o/dyld.h>
@@ -40,6 +45,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -1443,6 +1449,52 @@ bool FileSystem::FTruncate64(std::FILE* fp, s64 size, Error* error)
 #endif
 }
 
+const void* FileSystem::MapFileReadOnly(std::FILE* fp, size_t size, Error* error)
+{
+  const int fd = fileno(fp);
+  if (fd < 0)
+  {
+    Error::SetErrno(error, "fileno() failed: ", errno);
+    return nullptr;
+  }
+
+#ifdef _WIN32
+  const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    Error::SetWin32(error, "CreateFileMappingW() failed: ", GetLastError());
+    return nullptr;
+  }
+
+  // The view holds a reference to the mapping object, so we don't need to keep it around.
+  const void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+  if (!ptr)
+    Error::SetWin32(error, "MapViewOfFile() failed: ", GetLastError());
+
+  CloseHandle(mapping);
+  return ptr;
+#else
+  void* ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (ptr == MAP_FAILED)
+  {
+    Error::SetErrno(error, "mmap() failed: ", errno);
+    return nullptr;
+  }
+
+  return ptr;
+#endif
+}
+
+void FileSystem::UnmapFile(const void* ptr, size_t size)
+{
+#ifdef _WIN32
+  UnmapViewOfFile(ptr);
+#else
+  munmap(const_cast<void*>(ptr), size);
+#endif
+}
+
 s64 FileSystem::GetPathFileSize(const char* Path)
 {
   FILESYSTEM_STAT_DATA sd;
@@ -1677,7 +1729,8 @@ static u32 TranslateWin32Attributes(u32 w32attrs)
 }
 
 static u32 RecursiveFindFiles(const char* origin_path, const char* parent_path, const char* path, const char* pattern,
-                              u32 flags, FileSystem::FindResultsArray* results, std::vector<std::string>& visited)
+                              u32 flags, const FileSystem::FindFilesCallback& callback,
+                              std::vector<std::string>& visited)
 {
   std::string search_dir;
   if (path)
@@ -1752,11 +1805,11 @@ static u32 RecursiveFindFiles(const char* origin_path, const char* parent_path,
           {
             const std::string recurse_dir = fmt::format("{}\\{}", parent_path, path);
             nFiles += RecursiveFindFiles(origin_path, recurse_dir.c_str(), utf8_filename.c_str(), pattern, flags,
-                                         results, visited);
+                                         callback, visited);
           }
           else
           {
-            nFiles += RecursiveFindFiles(origin_path, path, utf8_filename.c_str(), pattern, flags, results, visited);
+            nFiles += RecursiveFindFiles(origin_path, path, utf8_filename.c_str(), pattern, flags, callback, visited);
           }
         }
       }
@@ -1807,18 +1860,16 @@ static u32 RecursiveFindFiles(const char* origin_path, const char* parent_path,
     outData.Size = (static_cast<u64>(wfd.nFileSizeHigh) << 32) | static_cast<u64>(wfd.nFileSizeLow);
 
     nFiles++;
-    results->push_back(std::move(outData));
+    callback(std::move(outData));
   } while (FindNextFileW(hFind, &wfd) == TRUE);
   FindClose(hFind);
 
   return nFiles;
 }
 
-bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, FindResultsArray* results)
+bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, const FindFilesCallback& callback)
 {
-  // clear result array
-  if (!(flags & FILESYSTEM_FIND_KEEP_ARRAY))
-    results->clear();
+  // FindFirstFileW() already returns sizes and timestamps, so enumeration is always done serially.
 
   // add self if recursive, we don't want to visit it twice
   std::vector<std::string> visited;
@@ -1830,8 +1881,20 @@ bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, Fin
   }
 
   // enter the recursive function
-  if (RecursiveFindFiles(path, nullptr, nullptr, pattern, flags, results, visited) == 0)
+  return (RecursiveFindFiles(path, nullptr, nullptr, pattern, flags, callback, visited) > 0);
+}
+
+bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, FindResultsArray* results)
+{
+  // clear result array
+  if (!(flags & FILESYSTEM_FIND_KEEP_ARRAY))
+    results->clear();
+
+  if (!FindFiles(path, pattern, flags,
+                 [results](FILESYSTEM_FIND_DATA&& data) { results->push_back(std::move(data)); }))
+  {
     return false;
+  }
 
   if (flags & FILESYSTEM_FIND_SORT_BY_NAME)
   {
@@ -2244,34 +2307,59 @@ static u32 TranslateStatAttributes(struct stat& st)
          (S_ISLNK(st.st_mode) ? FILESYSTEM_FILE_ATTRIBUTE_LINK : 0);
 }
 
-static u32 RecursiveFindFiles(const char* OriginPath, const char* ParentPath, const char* Path, const char* Pattern,
-                              u32 Flags, FileSystem::FindResultsArray* pResults, std::vector<std::string>& visited)
+namespace {
+struct FindFilesState
 {
-  std::string tempStr;
-  if (Path)
-  {
-    if (ParentPath)
-      tempStr = fmt::format("{}/{}/{}", OriginPath, ParentPath, Path);
-    else
-      tempStr = fmt::format("{}/{}", OriginPath, Path);
-  }
-  else
+  const char* origin_path;
+  const char* pattern;
+  const FileSystem::FindFilesCallback* callback;
+  u32 flags;
+  bool has_wildcards;
+  bool wildcard_match_all;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::string> pending_dirs;
+  std::set<std::pair<dev_t, ino_t>> visited;
+  u32 active_workers = 0;
+
+  std::mutex callback_mutex;
+  u32 num_found = 0;
+};
+} // namespace
+
+// Upper bound on enumeration threads. Mostly helps on network filesystems, where each call has high latency.
+static constexpr u32 MAX_FIND_FILES_THREADS = 8;
+
+static void FindFilesInDirectory(FindFilesState& state, const std::string& rel_dir)
+{
+  const std::string dir_path =
+    rel_dir.empty() ? std::string(state.origin_path) : fmt::format("{}/{}", state.origin_path, rel_dir);
+
+  const int dir_fd = open(dir_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (dir_fd < 0)
+    return;
+
+  // check that we're not following an infinite symbolic link loop
+  if (state.flags & FILESYSTEM_FIND_RECURSIVE)
   {
-    tempStr = fmt::format("{}", OriginPath);
+    struct stat dir_st;
+    if (fstat(dir_fd, &dir_st) == 0)
+    {
+      std::unique_lock lock(state.mutex);
+      if (!state.visited.emplace(dir_st.st_dev, dir_st.st_ino).second)
+      {
+        close(dir_fd);
+        return;
+      }
+    }
   }
 
-  DIR* pDir = opendir(tempStr.c_str());
+  DIR* pDir = fdopendir(dir_fd);
   if (!pDir)
-    return 0;
-
-  // small speed optimization for '*' case
-  bool hasWildCards = false;
-  bool wildCardMatchAll = false;
-  u32 nFiles = 0;
-  if (std::strpbrk(Pattern, "*?"))
   {
-    hasWildCards = true;
-    wildCardMatchAll = (std::strcmp(Pattern, "*") == 0);
+    close(dir_fd);
+    return;
   }
 
   // iterate results
@@ -2283,96 +2371,149 @@ static u32 RecursiveFindFiles(const char* OriginPath, const char* ParentPath, co
       if (pDirEnt->d_name[1] == '\0' || (pDirEnt->d_name[1] == '.' && pDirEnt->d_name[2] == '\0'))
         continue;
 
-      if (!(Flags & FILESYSTEM_FIND_HIDDEN_FILES))
+      if (!(state.flags & FILESYSTEM_FIND_HIDDEN_FILES))
         continue;
     }
 
-    std::string full_path;
-    if (ParentPath)
-      full_path = fmt::format("{}/{}/{}/{}", OriginPath, ParentPath, Path, pDirEnt->d_name);
-    else if (Path)
-      full_path = fmt::format("{}/{}/{}", OriginPath, Path, pDirEnt->d_name);
-    else
-      full_path = fmt::format("{}/{}", OriginPath, pDirEnt->d_name);
-
+    // d_type lets us skip the stat() for entries which get filtered out, but symlinks still have to be resolved.
     struct stat sDir;
-    if (stat(full_path.c_str(), &sDir) < 0)
-      continue;
+    bool has_stat = false;
+    bool is_dir;
+    if (pDirEnt->d_type == DT_DIR || pDirEnt->d_type == DT_REG)
+    {
+      is_dir = (pDirEnt->d_type == DT_DIR);
+    }
+    else
+    {
+      if (fstatat(dir_fd, pDirEnt->d_name, &sDir, 0) < 0)
+        continue;
 
-    FILESYSTEM_FIND_DATA outData;
-    outData.Attributes = TranslateStatAttributes(sDir);
+      has_stat = true;
+      is_dir = S_ISDIR(sDir.st_mode);
+    }
 
-    if (S_ISDIR(sDir.st_mode))
+    if (is_dir)
     {
-      if (Flags & FILESYSTEM_FIND_RECURSIVE)
+      if (state.flags & FILESYSTEM_FIND_RECURSIVE)
       {
-        // check that we're not following an infinite symbolic link loop
-        if (std::string real_recurse_dir = Path::RealPath(full_path);
-            real_recurse_dir.empty() || std::find(visited.begin(), visited.end(), real_recurse_dir) == visited.end())
+        std::string recurse_dir =
+          rel_dir.empty() ? std::string(pDirEnt->d_name) : fmt::format("{}/{}", rel_dir, pDirEnt->d_name);
+        if (state.flags & FILESYSTEM_FIND_PARALLEL)
         {
-          if (!real_recurse_dir.empty())
-            visited.push_back(std::move(real_recurse_dir));
-
-          // recurse into this directory
-          if (ParentPath)
-          {
-            const std::string recursive_dir = fmt::format("{}/{}", ParentPath, Path);
-            nFiles +=
-              RecursiveFindFiles(OriginPath, recursive_dir.c_str(), pDirEnt->d_name, Pattern, Flags, pResults, visited);
-          }
-          else
-          {
-            nFiles += RecursiveFindFiles(OriginPath, Path, pDirEnt->d_name, Pattern, Flags, pResults, visited);
-          }
+          std::unique_lock lock(state.mutex);
+          state.pending_dirs.push_back(std::move(recurse_dir));
+          state.cv.notify_one();
+        }
+        else
+        {
+          FindFilesInDirectory(state, recurse_dir);
         }
       }
 
-      if (!(Flags & FILESYSTEM_FIND_FOLDERS))
+      if (!(state.flags & FILESYSTEM_FIND_FOLDERS))
         continue;
     }
     else
     {
-      if (!(Flags & FILESYSTEM_FIND_FILES))
+      if (!(state.flags & FILESYSTEM_FIND_FILES))
         continue;
     }
 
-    outData.Size = static_cast<u64>(sDir.st_size);
-    outData.CreationTime = sDir.st_ctime;
-    outData.ModificationTime = sDir.st_mtime;
-
     // match the filename
-    if (hasWildCards)
+    if (state.has_wildcards)
     {
-      if (!wildCardMatchAll && !StringUtil::WildcardMatch(pDirEnt->d_name, Pattern))
+      if (!state.wildcard_match_all && !StringUtil::WildcardMatch(pDirEnt->d_name, state.pattern))
         continue;
     }
     else
     {
-      if (std::strcmp(pDirEnt->d_name, Pattern) != 0)
+      if (std::strcmp(pDirEnt->d_name, state.pattern) != 0)
         continue;
     }
 
+    if (!has_stat && fstatat(dir_fd, pDirEnt->d_name, &sDir, 0) < 0)
+      continue;
+
+    FILESYSTEM_FIND_DATA outData;
+    outData.Attributes = TranslateStatAttributes(sDir);
+    outData.Size = static_cast<u64>(sDir.st_size);
+    outData.CreationTime = sDir.st_ctime;
+    outData.ModificationTime = sDir.st_mtime;
+
     // add file to list
-    if (!(Flags & FILESYSTEM_FIND_RELATIVE_PATHS))
-    {
-      outData.FileName = std::move(full_path);
-    }
+    if (!(state.flags & FILESYSTEM_FIND_RELATIVE_PATHS))
+      outData.FileName = fmt::format("{}/{}", dir_path, pDirEnt->d_name);
+    else if (!rel_dir.empty())
+      outData.FileName = fmt::format("{}/{}", rel_dir, pDirEnt->d_name);
     else
-    {
-      if (ParentPath)
-        outData.FileName = fmt::format("{}/{}/{}", ParentPath, Path, pDirEnt->d_name);
-      else if (Path)
-        outData.FileName = fmt::format("{}/{}", Path, pDirEnt->d_name);
-      else
-        outData.FileName = pDirEnt->d_name;
-    }
+      outData.FileName = pDirEnt->d_name;
 
-    nFiles++;
-    pResults->push_back(std::move(outData));
+    std::unique_lock lock(state.callback_mutex);
+    state.num_found++;
+    (*state.callback)(std::move(outData));
   }
 
   closedir(pDir);
-  return nFiles;
+}
+
+static void FindFilesWorker(FindFilesState& state)
+{
+  std::unique_lock lock(state.mutex);
+  for (;;)
+  {
+    // finished once there's no more directories, and nobody is still enumerating one which could add more
+    state.cv.wait(lock, [&state]() { return (!state.pending_dirs.empty() || state.active_workers == 0); });
+    if (state.pending_dirs.empty())
+      break;
+
+    const std::string rel_dir = std::move(state.pending_dirs.front());
+    state.pending_dirs.pop_front();
+    state.active_workers++;
+    lock.unlock();
+
+    FindFilesInDirectory(state, rel_dir);
+
+    lock.lock();
+    state.active_workers--;
+    if (state.active_workers == 0 && state.pending_dirs.empty())
+      state.cv.notify_all();
+  }
+}
+
+bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, const FindFilesCallback& callback)
+{
+  FindFilesState state;
+  state.origin_path = path;
+  state.pattern = pattern;
+  state.callback = &callback;
+  state.flags = flags;
+
+  // small speed optimization for '*' case
+  state.has_wildcards = (std::strpbrk(pattern, "*?") != nullptr);
+  state.wildcard_match_all = (state.has_wildcards && std::strcmp(pattern, "*") == 0);
+
+  if ((flags & (FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_PARALLEL)) ==
+      (FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_PARALLEL))
+  {
+    state.pending_dirs.emplace_back();
+
+    const u32 num_threads = std::clamp(std::thread::hardware_concurrency(), 2u, MAX_FIND_FILES_THREADS);
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (u32 i = 1; i < num_threads; i++)
+      threads.emplace_back([&state]() { FindFilesWorker(state); });
+
+    FindFilesWorker(state);
+
+    for (std::thread& thread : threads)
+      thread.join();
+  }
+  else
+  {
+    FindFilesInDirectory(state, std::string());
+  }
+
+  return (state.num_found > 0);
 }
 
 bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, FindResultsArray* results)
@@ -2381,18 +2522,11 @@ bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, Fin
   if (!(flags & FILESYSTEM_FIND_KEEP_ARRAY))
     results->clear();
 
-  // add self if recursive, we don't want to visit it twice
-  std::vector<std::string> visited;
-  if (flags & FILESYSTEM_FIND_RECURSIVE)
+  if (!FindFiles(path, pattern, flags,
+                 [results](FILESYSTEM_FIND_DATA&& data) { results->push_back(std::move(data)); }))
   {
-    std::string real_path = Path::RealPath(path);
-    if (!real_path.empty())
-      visited.push_back(std::move(real_path));
-  }
-
-  // enter the recursive function
-  if (RecursiveFindFiles(path, nullptr, nullptr, pattern, flags, results, visited) == 0)
     return false;
+  }
 
   if (flags & FILESYSTEM_FIND_SORT_BY_NAME)
   {
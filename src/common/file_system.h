@@ -8,6 +8,7 @@
 
 #include <cstdio>
 #include <ctime>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -41,6 +42,7 @@ enum FILESYSTEM_FIND_FLAGS
   FILESYSTEM_FIND_FILES = (1 << 4),
   FILESYSTEM_FIND_KEEP_ARRAY = (1 << 5),
   FILESYSTEM_FIND_SORT_BY_NAME = (1 << 6),
+  FILESYSTEM_FIND_PARALLEL = (1 << 7),
 };
 
 struct FILESYSTEM_STAT_DATA
@@ -63,6 +65,10 @@ struct FILESYSTEM_FIND_DATA
 namespace FileSystem {
 using FindResultsArray = std::vector<FILESYSTEM_FIND_DATA>;
 
+/// Receives search results as they are found. With FILESYSTEM_FIND_PARALLEL, it can be called from worker threads,
+/// but never concurrently, and results are not returned in any particular order.
+using FindFilesCallback = std::function<void(FILESYSTEM_FIND_DATA&& data)>;
+
 /// Returns the display name of a filename. Usually this is the same as the path.
 std::string GetDisplayNameFromPath(std::string_view path);
 
@@ -72,6 +78,10 @@ std::vector<std::string> GetRootDirectoryList();
 /// Search for files
 bool FindFiles(const char* path, const char* pattern, u32 flags, FindResultsArray* results);
 
+/// Search for files, streaming results to a callback instead of building an array.
+/// FILESYSTEM_FIND_KEEP_ARRAY and FILESYSTEM_FIND_SORT_BY_NAME have no effect.
+bool FindFiles(const char* path, const char* pattern, u32 flags, const FindFilesCallback& callback);
+
 /// Stat file
 bool StatFile(const char* path, struct stat* st);
 bool StatFile(std::FILE* fp, struct stat* st);
@@ -122,6 +132,11 @@ s64 FTell64(std::FILE* fp);
 s64 FSize64(std::FILE* fp, Error* error = nullptr);
 bool FTruncate64(std::FILE* fp, s64 size, Error* error = nullptr);
 
+/// Maps the first size bytes of a file into memory for reading. The mapping remains valid after the file is closed,
+/// but the file must not be truncated while it is mapped.
+const void* MapFileReadOnly(std::FILE* fp, size_t size, Error* error = nullptr);
+void UnmapFile(const void* ptr, size_t size);
+
 int OpenFDFile(const char* filename, int flags, int mode, Error* error = nullptr);
 
 /// Sharing modes for OpenSharedCFile().
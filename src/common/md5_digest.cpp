@@ -3,6 +3,8 @@
 
 #include "md5_digest.h"
 
+#include <cstring>
+
 // based heavily on this public-domain implementation:
 // http://www.fourmilab.ch/md5/
 
@@ -22,11 +24,15 @@
  * reflect the addition of 16 longwords of new data.  MD5Update blocks
  * the data and converts bytes into longwords for this routine.
  */
-static void MD5Transform(u32 buf[4], u32 in[16])
+static void MD5Transform(u32 buf[4], const u8* data)
 {
   // register u32 a, b, c, d;
   u32 a, b, c, d;
 
+  // Loading through memcpy lets full blocks be hashed straight from the caller's buffer, regardless of alignment.
+  u32 in[16];
+  std::memcpy(in, data, sizeof(in));
+
   a = buf[0];
   b = buf[1];
   c = buf[2];
@@ -159,7 +165,7 @@ void MD5Digest::Update(const void* pData, u32 cbData)
       return;
     }
     std::memcpy(p, pByteData, t);
-    MD5Transform(this->buf, (u32*)this->in);
+    MD5Transform(this->buf, this->in);
     pByteData += t;
     cbData -= t;
   }
@@ -167,8 +173,7 @@ void MD5Digest::Update(const void* pData, u32 cbData)
 
   while (cbData >= 64)
   {
-    std::memcpy(this->in, pByteData, 64);
-    MD5Transform(this->buf, (u32*)this->in);
+    MD5Transform(this->buf, pByteData);
     pByteData += 64;
     cbData -= 64;
   }
@@ -205,7 +210,7 @@ void MD5Digest::Final(std::span<u8, DIGEST_SIZE> digest)
   {
     /* Two lots of padding:  Pad the first block to 64 bytes */
     std::memset(p, 0, count);
-    MD5Transform(this->buf, (u32*)this->in);
+    MD5Transform(this->buf, this->in);
 
     /* Now fill the next block with 56 bytes */
     std::memset(this->in, 0, 56);
@@ -217,9 +222,8 @@ void MD5Digest::Final(std::span<u8, DIGEST_SIZE> digest)
   }
 
   /* Append length in bits and transform */
-  ((u32*)this->in)[14] = this->bits[0];
-  ((u32*)this->in)[15] = this->bits[1];
+  std::memcpy(&this->in[56], this->bits, sizeof(this->bits));
 
-  MD5Transform(this->buf, (u32*)this->in);
+  MD5Transform(this->buf, this->in);
   std::memcpy(digest.data(), this->buf, 16);
 }
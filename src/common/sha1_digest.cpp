@@ -3,9 +3,31 @@
 
 #include "sha1_digest.h"
 #include "assert.h"
+#include "intrin.h"
 
 #include <cstring>
 
+#if defined(CPU_ARCH_X64) || defined(CPU_ARCH_X86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(CPU_ARCH_ARM64)
+#if defined(_WIN32)
+#include "windows_headers.h"
+#elif defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace {
+using SHA1TransformFunction = void (*)(u32 state[5], const u8* data, size_t num_blocks);
+}
+
+static bool s_acceleration_disabled = false;
+
 // mostly based on this implementation (public domain): https://gist.github.com/jrabbit/1042021
 #define rol(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
 
@@ -35,7 +57,7 @@
 
 /* Hash a single 512-bit block. This is the core of the algorithm. */
 
-static void SHA1Transform(u32 state[5], const unsigned char buffer[64])
+static void SHA1TransformBlock(u32 state[5], const unsigned char buffer[64])
 {
   u32 a, b, c, d, e;
   typedef union
@@ -142,6 +164,389 @@ static void SHA1Transform(u32 state[5], const unsigned char buffer[64])
   state[4] += e;
 }
 
+#undef R4
+#undef R3
+#undef R2
+#undef R1
+#undef R0
+#undef blk
+#undef blk0
+#undef rol
+
+static void SHA1TransformPortable(u32 state[5], const u8* data, size_t num_blocks)
+{
+  for (size_t i = 0; i < num_blocks; i++)
+    SHA1TransformBlock(state, &data[i * 64]);
+}
+
+#if defined(CPU_ARCH_X64) || defined(CPU_ARCH_X86)
+
+// Based on the public domain SHA intrinsics sample by Jeffrey Walton, itself based on code from Intel.
+#if defined(__GNUC__) || defined(__clang__)
+#define SHA1_TARGET_ACCELERATED __attribute__((target("sha,ssse3,sse4.1")))
+#else
+#define SHA1_TARGET_ACCELERATED
+#endif
+
+/* Each group of four rounds advances E with the next schedule vector, then runs the round function. */
+#define SHA1NI_ROUNDS(e_cur, e_next, msg, func)                                                                        \
+  e_cur = _mm_sha1nexte_epu32(e_cur, msg);                                                                             \
+  e_next = abcd;                                                                                                       \
+  abcd = _mm_sha1rnds4_epu32(abcd, e_cur, func);
+
+SHA1_TARGET_ACCELERATED static void SHA1TransformSHANI(u32 state[5], const u8* data, size_t num_blocks)
+{
+  const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+  __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+  __m128i e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+  __m128i e1;
+
+  for (; num_blocks > 0; num_blocks--, data += 64)
+  {
+    const __m128i abcd_save = abcd;
+    const __m128i e0_save = e0;
+
+    /* Rounds 0-3 */
+    __m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0)), mask);
+    e0 = _mm_add_epi32(e0, msg0);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+    /* Rounds 4-7 */
+    __m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), mask);
+    SHA1NI_ROUNDS(e1, e0, msg1, 0);
+    msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+    /* Rounds 8-11 */
+    __m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), mask);
+    SHA1NI_ROUNDS(e0, e1, msg2, 0);
+    msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+    msg0 = _mm_xor_si128(msg0, msg2);
+
+    /* Rounds 12-15 */
+    __m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), mask);
+    SHA1NI_ROUNDS(e1, e0, msg3, 0);
+    msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+    msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+    msg1 = _mm_xor_si128(msg1, msg3);
+
+    /* Rounds 16-19 */
+    SHA1NI_ROUNDS(e0, e1, msg0, 0);
+    msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+    msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+    msg2 = _mm_xor_si128(msg2, msg0);
+
+    /* Rounds 20-23 */
+    SHA1NI_ROUNDS(e1, e0, msg1, 1);
+    msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+    msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+    msg3 = _mm_xor_si128(msg3, msg1);
+
+    /* Rounds 24-27 */
+    SHA1NI_ROUNDS(e0, e1, msg2, 1);
+    msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+    msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+    msg0 = _mm_xor_si128(msg0, msg2);
+
+    /* Rounds 28-31 */
+    SHA1NI_ROUNDS(e1, e0, msg3, 1);
+    msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+    msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+    msg1 = _mm_xor_si128(msg1, msg3);
+
+    /* Rounds 32-35 */
+    SHA1NI_ROUNDS(e0, e1, msg0, 1);
+    msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+    msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+    msg2 = _mm_xor_si128(msg2, msg0);
+
+    /* Rounds 36-39 */
+    SHA1NI_ROUNDS(e1, e0, msg1, 1);
+    msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+    msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+    msg3 = _mm_xor_si128(msg3, msg1);
+
+    /* Rounds 40-43 */
+    SHA1NI_ROUNDS(e0, e1, msg2, 2);
+    msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+    msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+    msg0 = _mm_xor_si128(msg0, msg2);
+
+    /* Rounds 44-47 */
+    SHA1NI_ROUNDS(e1, e0, msg3, 2);
+    msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+    msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+    msg1 = _mm_xor_si128(msg1, msg3);
+
+    /* Rounds 48-51 */
+    SHA1NI_ROUNDS(e0, e1, msg0, 2);
+    msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+    msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+    msg2 = _mm_xor_si128(msg2, msg0);
+
+    /* Rounds 52-55 */
+    SHA1NI_ROUNDS(e1, e0, msg1, 2);
+    msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+    msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+    msg3 = _mm_xor_si128(msg3, msg1);
+
+    /* Rounds 56-59 */
+    SHA1NI_ROUNDS(e0, e1, msg2, 2);
+    msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+    msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+    msg0 = _mm_xor_si128(msg0, msg2);
+
+    /* Rounds 60-63 */
+    SHA1NI_ROUNDS(e1, e0, msg3, 3);
+    msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+    msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+    msg1 = _mm_xor_si128(msg1, msg3);
+
+    /* Rounds 64-67 */
+    SHA1NI_ROUNDS(e0, e1, msg0, 3);
+    msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+    msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+    msg2 = _mm_xor_si128(msg2, msg0);
+
+    /* Rounds 68-71 */
+    SHA1NI_ROUNDS(e1, e0, msg1, 3);
+    msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+    msg3 = _mm_xor_si128(msg3, msg1);
+
+    /* Rounds 72-75 */
+    SHA1NI_ROUNDS(e0, e1, msg2, 3);
+    msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+
+    /* Rounds 76-79 */
+    SHA1NI_ROUNDS(e1, e0, msg3, 3);
+
+    /* Combine state */
+    e0 = _mm_sha1nexte_epu32(e0, e0_save);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1B));
+  state[4] = static_cast<u32>(_mm_extract_epi32(e0, 3));
+}
+
+#undef SHA1NI_ROUNDS
+
+static bool HasAcceleratedSHA1()
+{
+  int regs1[4], regs7[4];
+#ifdef _MSC_VER
+  __cpuid(regs1, 0);
+  if (regs1[0] < 7)
+    return false;
+  __cpuidex(regs1, 1, 0);
+  __cpuidex(regs7, 7, 0);
+#else
+  unsigned int a, b, c, d;
+  if (!__get_cpuid_count(1, 0, &a, &b, &c, &d))
+    return false;
+  regs1[2] = static_cast<int>(c);
+  if (!__get_cpuid_count(7, 0, &a, &b, &c, &d))
+    return false;
+  regs7[1] = static_cast<int>(b);
+#endif
+
+  const bool has_ssse3 = (regs1[2] & (1 << 9)) != 0;
+  const bool has_sse41 = (regs1[2] & (1 << 19)) != 0;
+  const bool has_sha = (regs7[1] & (1 << 29)) != 0;
+  return (has_ssse3 && has_sse41 && has_sha);
+}
+
+#elif defined(CPU_ARCH_ARM64)
+
+// Based on the public domain ARMv8 SHA intrinsics sample by Jeffrey Walton.
+#if defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO) || defined(_MSC_VER)
+#define SHA1_TARGET_ACCELERATED
+#elif defined(__clang__)
+#define SHA1_TARGET_ACCELERATED __attribute__((target("sha2")))
+#else
+#define SHA1_TARGET_ACCELERATED __attribute__((target("+crypto")))
+#endif
+
+/* Four rounds with the given round function, using the K-added schedule in tmp. Computes the E for the next group
+   from the current A. The caller updates the message schedule and tmp between groups. */
+#define SHA1CE_ROUNDS(op, e_cur, e_next, tmp)                                                                          \
+  e_next = vsha1h_u32(vgetq_lane_u32(abcd, 0));                                                                        \
+  abcd = op(abcd, e_cur, tmp);
+
+SHA1_TARGET_ACCELERATED static void SHA1TransformARMv8(u32 state[5], const u8* data, size_t num_blocks)
+{
+  const uint32x4_t k0 = vdupq_n_u32(0x5A827999);
+  const uint32x4_t k1 = vdupq_n_u32(0x6ED9EBA1);
+  const uint32x4_t k2 = vdupq_n_u32(0x8F1BBCDC);
+  const uint32x4_t k3 = vdupq_n_u32(0xCA62C1D6);
+
+  uint32x4_t abcd = vld1q_u32(&state[0]);
+  u32 e0 = state[4];
+  u32 e1;
+
+  for (; num_blocks > 0; num_blocks--, data += 64)
+  {
+    const uint32x4_t abcd_save = abcd;
+    const u32 e0_save = e0;
+
+    uint32x4_t msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+    uint32x4_t msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+    uint32x4_t msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+    uint32x4_t msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+    uint32x4_t tmp0 = vaddq_u32(msg0, k0);
+    uint32x4_t tmp1 = vaddq_u32(msg1, k0);
+
+    /* Rounds 0-3 */
+    SHA1CE_ROUNDS(vsha1cq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg2, k0);
+    msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+    /* Rounds 4-7 */
+    SHA1CE_ROUNDS(vsha1cq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg3, k0);
+    msg0 = vsha1su1q_u32(msg0, msg3);
+    msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+    /* Rounds 8-11 */
+    SHA1CE_ROUNDS(vsha1cq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg0, k0);
+    msg1 = vsha1su1q_u32(msg1, msg0);
+    msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+    /* Rounds 12-15 */
+    SHA1CE_ROUNDS(vsha1cq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg1, k1);
+    msg2 = vsha1su1q_u32(msg2, msg1);
+    msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+    /* Rounds 16-19 */
+    SHA1CE_ROUNDS(vsha1cq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg2, k1);
+    msg3 = vsha1su1q_u32(msg3, msg2);
+    msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+    /* Rounds 20-23 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg3, k1);
+    msg0 = vsha1su1q_u32(msg0, msg3);
+    msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+    /* Rounds 24-27 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg0, k1);
+    msg1 = vsha1su1q_u32(msg1, msg0);
+    msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+    /* Rounds 28-31 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg1, k1);
+    msg2 = vsha1su1q_u32(msg2, msg1);
+    msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+    /* Rounds 32-35 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg2, k2);
+    msg3 = vsha1su1q_u32(msg3, msg2);
+    msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+    /* Rounds 36-39 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg3, k2);
+    msg0 = vsha1su1q_u32(msg0, msg3);
+    msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+    /* Rounds 40-43 */
+    SHA1CE_ROUNDS(vsha1mq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg0, k2);
+    msg1 = vsha1su1q_u32(msg1, msg0);
+    msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+    /* Rounds 44-47 */
+    SHA1CE_ROUNDS(vsha1mq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg1, k2);
+    msg2 = vsha1su1q_u32(msg2, msg1);
+    msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+    /* Rounds 48-51 */
+    SHA1CE_ROUNDS(vsha1mq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg2, k2);
+    msg3 = vsha1su1q_u32(msg3, msg2);
+    msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+    /* Rounds 52-55 */
+    SHA1CE_ROUNDS(vsha1mq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg3, k3);
+    msg0 = vsha1su1q_u32(msg0, msg3);
+    msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+    /* Rounds 56-59 */
+    SHA1CE_ROUNDS(vsha1mq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg0, k3);
+    msg1 = vsha1su1q_u32(msg1, msg0);
+    msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+    /* Rounds 60-63 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg1, k3);
+    msg2 = vsha1su1q_u32(msg2, msg1);
+    msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+    /* Rounds 64-67 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e0, e1, tmp0);
+    tmp0 = vaddq_u32(msg2, k3);
+    msg3 = vsha1su1q_u32(msg3, msg2);
+
+    /* Rounds 68-71 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e1, e0, tmp1);
+    tmp1 = vaddq_u32(msg3, k3);
+
+    /* Rounds 72-75 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e0, e1, tmp0);
+
+    /* Rounds 76-79 */
+    SHA1CE_ROUNDS(vsha1pq_u32, e1, e0, tmp1);
+
+    /* Combine state */
+    e0 += e0_save;
+    abcd = vaddq_u32(abcd_save, abcd);
+  }
+
+  vst1q_u32(&state[0], abcd);
+  state[4] = e0;
+}
+
+#undef SHA1CE_ROUNDS
+
+static bool HasAcceleratedSHA1()
+{
+#if defined(__APPLE__)
+  return true;
+#elif defined(_WIN32)
+  return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE);
+#elif defined(__linux__)
+  return (getauxval(AT_HWCAP) & HWCAP_SHA1) != 0;
+#else
+  return false;
+#endif
+}
+
+#endif
+
+static SHA1TransformFunction GetSHA1Transform()
+{
+  if (!SHA1Digest::IsAccelerated())
+    return &SHA1TransformPortable;
+#if defined(CPU_ARCH_X64) || defined(CPU_ARCH_X86)
+  return &SHA1TransformSHANI;
+#elif defined(CPU_ARCH_ARM64)
+  return &SHA1TransformARMv8;
+#else
+  return &SHA1TransformPortable;
+#endif
+}
+
 SHA1Digest::SHA1Digest()
 {
   Reset();
@@ -160,6 +565,21 @@ void SHA1Digest::Reset()
   count[0] = count[1] = 0;
 }
 
+bool SHA1Digest::IsAccelerated()
+{
+#if defined(CPU_ARCH_X64) || defined(CPU_ARCH_X86) || defined(CPU_ARCH_ARM64)
+  static const bool accelerated = HasAcceleratedSHA1();
+  return (accelerated && !s_acceleration_disabled);
+#else
+  return false;
+#endif
+}
+
+void SHA1Digest::SetAccelerationEnabled(bool enabled)
+{
+  s_acceleration_disabled = !enabled;
+}
+
 std::string SHA1Digest::DigestToString(const std::span<u8, DIGEST_SIZE> digest)
 {
   std::string ret;
@@ -214,11 +634,16 @@ void SHA1Digest::Update(const void* data, size_t len)
   j = (j >> 3) & 63;
   if ((j + ulen) > 63)
   {
+    const SHA1TransformFunction transform = GetSHA1Transform();
     std::memcpy(&buffer[j], bdata, (i = 64 - j));
-    SHA1Transform(state, buffer);
-    for (; i + 63 < ulen; i += 64)
+    transform(state, buffer, 1);
+
+    // Hand all remaining complete blocks to the transform at once, so the state stays in registers.
+    const u32 num_blocks = (ulen - i) / 64;
+    if (num_blocks > 0)
     {
-      SHA1Transform(state, &bdata[i]);
+      transform(state, &bdata[i], num_blocks);
+      i += num_blocks * 64;
     }
     j = 0;
   }
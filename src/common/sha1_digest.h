@@ -26,6 +26,12 @@ public:
 
   static std::string DigestToString(const std::span<u8, DIGEST_SIZE> digest);
 
+  /// Returns true if the host supports SHA instructions (SHA-NI or ARMv8 crypto), and they will be used.
+  static bool IsAccelerated();
+
+  /// Forces the portable transform when disabled. Used by tests to compare both implementations.
+  static void SetAccelerationEnabled(bool enabled);
+
   static std::array<u8, DIGEST_SIZE> GetDigest(const void* data, size_t len);
   static std::array<u8, DIGEST_SIZE> GetDigest(std::span<const u8> data);
 
@@ -8,6 +8,7 @@
 #include "bios.h"
 #include "bus.h"
 #include "cpu_core.h"
+#include "fingerprint_cache.h"
 #include "fullscreen_ui.h"
 #include "host.h"
 #include "system.h"
@@ -276,6 +277,13 @@ void Achievements::ReportRCError(int err, fmt::format_string<T...> fmt, T&&... a
 
 std::string Achievements::GetGameHash(CDImage* image)
 {
+  std::string cached_hash;
+  if (FingerprintCache::GetAchievementsHash(image, &cached_hash))
+  {
+    INFO_LOG("Cached hash for '{}': {}", Path::GetFileName(image->GetFileName()), cached_hash);
+    return cached_hash;
+  }
+
   std::string executable_name;
   std::vector<u8> executable_data;
   if (!System::ReadExecutableFromImage(image, &executable_name, &executable_data))
@@ -310,6 +318,7 @@ std::string Achievements::GetGameHash(CDImage* image)
 
   INFO_LOG("Hash for '{}' ({} bytes, {} bytes hashed): {}", executable_name, executable_data.size(), hash_size,
            hash_str);
+  FingerprintCache::SetAchievementsHash(image, hash_str);
   return hash_str;
 }
 
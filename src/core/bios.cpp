@@ -3,6 +3,7 @@
 
 #include "bios.h"
 #include "cpu_disasm.h"
+#include "fingerprint_cache.h"
 #include "host.h"
 #include "mips_encoder.h"
 #include "settings.h"
@@ -15,10 +16,14 @@
 #include "common/path.h"
 #include "common/string_util.h"
 
+#include <cerrno>
+
 Log_SetChannel(BIOS);
 
 namespace BIOS {
-static const ImageInfo* GetInfoForHash(const std::span<u8> image, const ImageInfo::Hash& hash);
+static bool IsOpenBIOSImage(const std::span<const u8> image);
+static const ImageInfo* GetInfoForHash(const ImageInfo::Hash& hash, bool is_openbios);
+static bool GetImageInfoForFile(const char* filename, const ImageInfo** info);
 
 static constexpr ImageInfo::Hash MakeHashFromString(const char str[])
 {
@@ -189,7 +194,28 @@ std::optional<BIOS::Image> BIOS::LoadImageFromFile(const char* filename, Error*
     return ret;
   }
 
-  // We want to hash the whole file. That means reading the whole thing in, if it's a larger BIOS (PS2).
+  // If we've hashed this file before, we only need the first 512KB, since that's all that's mapped.
+  ImageInfo::Hash hash;
+  bool is_openbios;
+  if (FingerprintCache::GetBIOSHash(filename, &hash, &is_openbios))
+  {
+    ret = BIOS::Image();
+    ret->hash = hash;
+    ret->data.resize(BIOS_SIZE);
+    if (std::fread(ret->data.data(), BIOS_SIZE, 1, fp.get()) != 1)
+    {
+      Error::SetErrno(error, "fread() failed: ", errno);
+      ret.reset();
+      return ret;
+    }
+
+    ret->info = GetInfoForHash(hash, is_openbios);
+    DEV_LOG("Cached hash for BIOS '{}': {}", FileSystem::GetDisplayNameFromPath(filename),
+            ImageInfo::GetHashString(ret->hash));
+    return ret;
+  }
+
+  // Otherwise we want to hash the whole file. That means reading the whole thing in, if it's a larger BIOS (PS2).
   std::optional<DynamicHeapArray<u8>> data = FileSystem::ReadBinaryFile(fp.get(), error);
   if (!data.has_value() || data->size() < BIOS_SIZE)
     return ret;
@@ -200,21 +226,43 @@ std::optional<BIOS::Image> BIOS::LoadImageFromFile(const char* filename, Error*
   // But only copy the first 512KB, since that's all that's mapped.
   ret->data = std::move(data.value());
   ret->data.resize(BIOS_SIZE);
-  ret->info = GetInfoForHash(ret->data, ret->hash);
+  is_openbios = IsOpenBIOSImage(ret->data);
+  ret->info = GetInfoForHash(ret->hash, is_openbios);
+  FingerprintCache::SetBIOSHash(filename, ret->hash, is_openbios);
 
   DEV_LOG("Hash for BIOS '{}': {}", FileSystem::GetDisplayNameFromPath(filename), ImageInfo::GetHashString(ret->hash));
   return ret;
 }
 
-const BIOS::ImageInfo* BIOS::GetInfoForHash(const std::span<u8> image, const ImageInfo::Hash& hash)
+bool BIOS::GetImageInfoForFile(const char* filename, const ImageInfo** info)
 {
-  // check for openbios
-  if (image.size() >= (s_openbios_signature_offset + std::size(s_openbios_signature)) &&
-      std::memcmp(&image[s_openbios_signature_offset], s_openbios_signature, std::size(s_openbios_signature)) == 0)
+  ImageInfo::Hash hash;
+  bool is_openbios;
+  if (FingerprintCache::GetBIOSHash(filename, &hash, &is_openbios))
   {
-    return &s_openbios_info;
+    *info = GetInfoForHash(hash, is_openbios);
+    return true;
   }
 
+  const std::optional<Image> image = LoadImageFromFile(filename, nullptr);
+  if (!image.has_value())
+    return false;
+
+  *info = image->info;
+  return true;
+}
+
+bool BIOS::IsOpenBIOSImage(const std::span<const u8> image)
+{
+  return (image.size() >= (s_openbios_signature_offset + std::size(s_openbios_signature)) &&
+          std::memcmp(&image[s_openbios_signature_offset], s_openbios_signature, std::size(s_openbios_signature)) == 0);
+}
+
+const BIOS::ImageInfo* BIOS::GetInfoForHash(const ImageInfo::Hash& hash, bool is_openbios)
+{
+  if (is_openbios)
+    return &s_openbios_info;
+
   for (const ImageInfo& ii : s_image_info_by_hash)
   {
     if (ii.hash == hash)
@@ -369,10 +417,12 @@ std::optional<BIOS::Image> BIOS::FindBIOSImageInDirectory(ConsoleRegion region,
   FileSystem::FindFiles(
     directory, "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RELATIVE_PATHS, &results);
 
-  std::optional<Image> image;
+  // Pick the best image using the cached hashes where possible, then only load the one we're using.
   std::string image_path;
+  const ImageInfo* image_info = nullptr;
   bool image_region_match = false;
 
+  FingerprintCache::BeginBatch();
   for (const FILESYSTEM_FIND_DATA& fd : results)
   {
     if (fd.Size != BIOS_SIZE && fd.Size != BIOS_SIZE_PS2 && fd.Size != BIOS_SIZE_PS3)
@@ -382,23 +432,28 @@ std::optional<BIOS::Image> BIOS::FindBIOSImageInDirectory(ConsoleRegion region,
     }
 
     std::string full_path(Path::Combine(directory, fd.FileName));
-    std::optional<Image> found_image = LoadImageFromFile(full_path.c_str(), nullptr);
-    if (!found_image.has_value())
+    const ImageInfo* found_info;
+    if (!GetImageInfoForFile(full_path.c_str(), &found_info))
       continue;
 
     // don't let an unknown bios take precedence over a known one
-    const bool region_match = (found_image->info && IsValidBIOSForRegion(region, found_image->info->region));
-    if (image.has_value() &&
-        ((image->info && !found_image->info) || (image_region_match && !region_match) ||
-         (image->info && found_image->info && image->info->priority < found_image->info->priority)))
+    const bool region_match = (found_info && IsValidBIOSForRegion(region, found_info->region));
+    if (!image_path.empty() &&
+        ((image_info && !found_info) || (image_region_match && !region_match) ||
+         (image_info && found_info && image_info->priority < found_info->priority)))
     {
       continue;
     }
 
-    image = std::move(found_image);
+    image_info = found_info;
     image_path = std::move(full_path);
     image_region_match = region_match;
   }
+  FingerprintCache::EndBatch();
+
+  std::optional<Image> image;
+  if (!image_path.empty())
+    image = LoadImageFromFile(image_path.c_str(), error);
 
   if (!image.has_value())
   {
@@ -431,18 +486,20 @@ std::vector<std::pair<std::string, const BIOS::ImageInfo*>> BIOS::FindBIOSImages
   FileSystem::FindFiles(directory, "*",
                         FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RELATIVE_PATHS, &files);
 
+  FingerprintCache::BeginBatch();
   for (FILESYSTEM_FIND_DATA& fd : files)
   {
     if (fd.Size != BIOS_SIZE && fd.Size != BIOS_SIZE_PS2 && fd.Size != BIOS_SIZE_PS3)
       continue;
 
     std::string full_path(Path::Combine(directory, fd.FileName));
-    std::optional<Image> found_image = LoadImageFromFile(full_path.c_str(), nullptr);
-    if (!found_image)
+    const ImageInfo* info;
+    if (!GetImageInfoForFile(full_path.c_str(), &info))
       continue;
 
-    results.emplace_back(std::move(fd.FileName), found_image->info);
+    results.emplace_back(std::move(fd.FileName), info);
   }
+  FingerprintCache::EndBatch();
 
   return results;
 }
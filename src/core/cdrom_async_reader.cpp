@@ -119,14 +119,14 @@ void CDROMAsyncReader::QueueReadSector(CDImage::LBA lba)
       return;
     }
 
-    // did we readahead to the correct sector?
-    const u32 next_buffer = (buffer_front + 1) % static_cast<u32>(m_buffers.size());
-    if (m_buffer_count > 1 && m_buffers[next_buffer].lba == lba)
+    // did we readahead to the correct sector? short forward seeks can skip over the sectors before it
+    const s32 offset = FindBufferedSector(lba);
+    if (offset > 0)
     {
       // great, don't need a seek, but still kick the thread to start reading ahead again
-      DEBUG_LOG("Readahead buffer hit for sector {}", lba);
-      m_buffer_front.store(next_buffer);
-      m_buffer_count.fetch_sub(1);
+      DEBUG_LOG("Readahead buffer hit for sector {} (skipped {})", lba, offset - 1);
+      m_buffer_front.store((buffer_front + static_cast<u32>(offset)) % static_cast<u32>(m_buffers.size()));
+      m_buffer_count.fetch_sub(static_cast<u32>(offset));
       m_can_readahead.store(true);
       m_do_read_cv.notify_one();
       return;
@@ -148,6 +148,22 @@ bool CDROMAsyncReader::ReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ
 
   std::unique_lock lock(m_mutex);
 
+  // Sectors which have already been read ahead can be returned without stopping the thread, or moving the image.
+  // The lock is held for the copy, the thread only releases it while filling a slot outside the buffered range.
+  if (const s32 offset = FindBufferedSector(lba); offset >= 0)
+  {
+    const BufferSlot& buffer =
+      m_buffers[(m_buffer_front.load() + static_cast<u32>(offset)) % static_cast<u32>(m_buffers.size())];
+    if (buffer.result)
+    {
+      if (subq)
+        *subq = buffer.subq;
+      if (data)
+        *data = buffer.data;
+      return true;
+    }
+  }
+
   // wait until the read thread is idle
   m_notify_read_complete_cv.wait(lock, [this]() { return !m_is_reading.load(); });
 
@@ -163,6 +179,28 @@ bool CDROMAsyncReader::ReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ
   return result;
 }
 
+s32 CDROMAsyncReader::FindBufferedSector(CDImage::LBA lba) const
+{
+  // A pending seek means the thread is about to empty the buffers. The flag must be checked before loading the
+  // count, since the thread clears it after emptying, and a count loaded first could be from before the seek.
+  if (m_next_position_set.load())
+    return -1;
+
+  const u32 count = m_buffer_count.load();
+  if (count == 0)
+    return -1;
+
+  // Sectors are read ahead sequentially, so the slot can be computed from the front.
+  const u32 front = m_buffer_front.load();
+  const CDImage::LBA front_lba = m_buffers[front].lba;
+  if (lba < front_lba || (lba - front_lba) >= count)
+    return -1;
+
+  const u32 offset = lba - front_lba;
+  const u32 slot = (front + offset) % static_cast<u32>(m_buffers.size());
+  return (m_buffers[slot].lba == lba) ? static_cast<s32>(offset) : -1;
+}
+
 bool CDROMAsyncReader::InternalReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data)
 {
   if (m_media->GetPositionOnDisc() != lba && !m_media->Seek(lba)) [[unlikely]]
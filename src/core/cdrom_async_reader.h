@@ -61,6 +61,9 @@ private:
   void EmptyBuffers();
   bool ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock);
   void ReadSectorNonThreaded(CDImage::LBA lba);
+
+  /// Returns the position of the sector relative to the front of the buffer, or -1 if it hasn't been read ahead.
+  s32 FindBufferedSector(CDImage::LBA lba) const;
   bool InternalReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data);
   void CancelReadahead();
 
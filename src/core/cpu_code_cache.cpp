@@ -7,11 +7,13 @@
 #include "cpu_core_private.h"
 #include "cpu_disasm.h"
 #include "cpu_recompiler_types.h"
+#include "gpu.h"
 #include "host.h"
 #include "settings.h"
 #include "system.h"
 #include "timing_event.h"
 
+#include "util/memory_usage.h"
 #include "util/page_fault_handler.h"
 
 #include "common/align.h"
@@ -57,6 +59,9 @@ static constexpr u32 RECOMPILE_FRAMES_FOR_INTERPRETER_FALLBACK = 15;
 static constexpr u32 INVALIDATE_COUNT_FOR_MANUAL_PROTECTION = 4;
 static constexpr u32 INVALIDATE_FRAMES_FOR_MANUAL_PROTECTION = 60;
 
+// Longest loop, including the delay slot, that will be considered for idle loop skipping.
+static constexpr u32 MAX_IDLE_LOOP_INSTRUCTIONS = 16;
+
 static CodeLUT DecodeCodeLUTPointer(u32 slot, CodeLUT ptr);
 static CodeLUT EncodeCodeLUTPointer(u32 slot, CodeLUT ptr);
 static CodeLUT OffsetCodeLUTPointer(CodeLUT fake_ptr, u32 pc);
@@ -75,6 +80,9 @@ static bool RevalidateBlock(Block* block);
 PageProtectionMode GetProtectionModeForPC(u32 pc);
 PageProtectionMode GetProtectionModeForBlock(const Block* block);
 static bool ReadBlockInstructions(u32 start_pc, BlockInstructionList* instructions, BlockMetadata* metadata);
+static bool GetIdleLoopRegisterAccess(const Instruction inst, u32* reads, u32* writes);
+static bool IsIdleLoop(u32 start_pc, const BlockInstructionList& instructions);
+static void TrySkipIdleLoop(const Block* block);
 static void FillBlockRegInfo(Block* block);
 static void CopyRegInfo(InstructionInfo* dst, const InstructionInfo* src);
 static void SetRegAccess(InstructionInfo* inst, Reg reg, bool write);
@@ -201,11 +209,13 @@ bool CPU::CodeCache::ProcessStartup(Error* error)
   if (!PageFaultHandler::Install(error))
     return false;
 
+  MemoryUsage::Add(MemoryUsage::Category::CPUCodeBuffer, RECOMPILER_CODE_CACHE_SIZE);
   return true;
 }
 
 void CPU::CodeCache::ProcessShutdown()
 {
+  MemoryUsage::Remove(MemoryUsage::Category::CPUCodeBuffer, RECOMPILER_CODE_CACHE_SIZE);
   DeallocateLUTs();
 
 #ifndef USE_CODE_BUFFER_SECTION
@@ -821,7 +831,15 @@ template<PGXPMode pgxp_mode>
 
       // Handle self-looping blocks
       if (g_state.pc == block->pc)
+      {
+        if (block->HasFlag(BlockFlags::IsIdleLoop))
+        {
+          TrySkipIdleLoop(block);
+          CHECK_DOWNCOUNT();
+        }
+
         goto reexecute_block;
+      }
       else
         continue;
 
@@ -896,6 +914,11 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
 #endif
 
   instructions->clear();
+
+  // Kernel call vector has to go through the interpreter, so that calls can be intercepted.
+  if (IsHLEKernelCallVector(start_pc)) [[unlikely]]
+    return false;
+
   metadata->icache_line_count = 0;
   metadata->uncached_fetch_ticks = 0;
   metadata->flags = use_icache ? BlockFlags::IsUsingICache :
@@ -1019,6 +1042,12 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
 
   instructions->back().second.is_last_instruction = true;
 
+  if (g_settings.cpu_idle_loop_skipping && IsIdleLoop(start_pc, *instructions))
+  {
+    DEV_LOG("Block 0x{:08X} is an idle loop", start_pc);
+    metadata->flags |= BlockFlags::IsIdleLoop;
+  }
+
 #ifdef _DEBUG
   SmallString disasm;
   DEBUG_LOG("Block at 0x{:08X}", start_pc);
@@ -1035,6 +1064,206 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
   return true;
 }
 
+bool CPU::CodeCache::GetIdleLoopRegisterAccess(const Instruction inst, u32* reads, u32* writes)
+{
+  const u32 rs = (1u << static_cast<u8>(inst.r.rs.GetValue()));
+  const u32 rt = (1u << static_cast<u8>(inst.r.rt.GetValue()));
+  const u32 rd = (1u << static_cast<u8>(inst.r.rd.GetValue()));
+
+  switch (inst.op)
+  {
+    case InstructionOp::funct:
+    {
+      switch (inst.r.funct)
+      {
+        case InstructionFunct::sll:
+        case InstructionFunct::srl:
+        case InstructionFunct::sra:
+          *reads = rt;
+          *writes = rd;
+          return true;
+
+        case InstructionFunct::sllv:
+        case InstructionFunct::srlv:
+        case InstructionFunct::srav:
+        case InstructionFunct::add:
+        case InstructionFunct::addu:
+        case InstructionFunct::sub:
+        case InstructionFunct::subu:
+        case InstructionFunct::and_:
+        case InstructionFunct::or_:
+        case InstructionFunct::xor_:
+        case InstructionFunct::nor:
+        case InstructionFunct::slt:
+        case InstructionFunct::sltu:
+          *reads = rs | rt;
+          *writes = rd;
+          return true;
+
+        default:
+          return false;
+      }
+    }
+
+    case InstructionOp::b:
+    {
+      // Linking variants write ra.
+      if ((static_cast<u8>(inst.i.rt.GetValue()) & u8(0x1E)) == u8(0x10))
+        return false;
+
+      *reads = rs;
+      *writes = 0;
+      return true;
+    }
+
+    case InstructionOp::j:
+      *reads = 0;
+      *writes = 0;
+      return true;
+
+    case InstructionOp::beq:
+    case InstructionOp::bne:
+      *reads = rs | rt;
+      *writes = 0;
+      return true;
+
+    case InstructionOp::blez:
+    case InstructionOp::bgtz:
+      *reads = rs;
+      *writes = 0;
+      return true;
+
+    case InstructionOp::addi:
+    case InstructionOp::addiu:
+    case InstructionOp::slti:
+    case InstructionOp::sltiu:
+    case InstructionOp::andi:
+    case InstructionOp::ori:
+    case InstructionOp::xori:
+    case InstructionOp::lb:
+    case InstructionOp::lh:
+    case InstructionOp::lw:
+    case InstructionOp::lbu:
+    case InstructionOp::lhu:
+      *reads = rs;
+      *writes = rt;
+      return true;
+
+    case InstructionOp::lui:
+      *reads = 0;
+      *writes = rt;
+      return true;
+
+    case InstructionOp::lwl:
+    case InstructionOp::lwr:
+      *reads = rs | rt;
+      *writes = rt;
+      return true;
+
+    // Stores, coprocessor instructions, calls, etc. all have side effects.
+    default:
+      return false;
+  }
+}
+
+bool CPU::CodeCache::IsIdleLoop(u32 start_pc, const BlockInstructionList& instructions)
+{
+  // Must be a short block which ends by branching back to its start.
+  if (instructions.size() < 2 || instructions.size() > MAX_IDLE_LOOP_INSTRUCTIONS)
+    return false;
+
+  const BlockInstructionInfoPair& branch = instructions[instructions.size() - 2];
+  if (!branch.second.is_direct_branch_instruction || IsCallInstruction(branch.first) ||
+      GetDirectBranchTarget(branch.first, branch.second.pc) != start_pc)
+  {
+    return false;
+  }
+
+  // Load in the delay slot would be visible to the first instruction of the next iteration.
+  if (instructions.back().second.has_load_delay)
+    return false;
+
+  // Every iteration must behave identically, i.e. any register which is read before it is written in the loop must
+  // not be written at all. Load base registers can't be changed after the load either, since the address is checked
+  // against the register values at the end of the iteration.
+  constexpr u32 ZERO_MASK = ~1u;
+  u32 written = 0;
+  u32 all_written = 0;
+  u32 read_before_written = 0;
+  u32 pending_load = 0;
+  u32 load_base_regs = 0;
+  for (const auto& [inst, info] : instructions)
+  {
+    u32 reads, writes;
+    if (!GetIdleLoopRegisterAccess(inst, &reads, &writes))
+      return false;
+
+    reads &= ZERO_MASK;
+    writes &= ZERO_MASK;
+    if (writes & load_base_regs)
+      return false;
+
+    read_before_written |= (reads & ~written);
+    written |= std::exchange(pending_load, 0);
+    if (info.has_load_delay)
+    {
+      pending_load = writes;
+      load_base_regs |= (1u << static_cast<u8>(inst.i.rs.GetValue())) & ZERO_MASK;
+    }
+    else
+    {
+      written |= writes;
+    }
+
+    all_written |= writes;
+  }
+
+  return ((read_before_written & all_written) == 0);
+}
+
+void CPU::CodeCache::TrySkipIdleLoop(const Block* block)
+{
+  if (g_state.pending_ticks >= g_state.downcount)
+    return;
+
+  // The loop can only be skipped if none of its loads have side effects, or depend on anything other than events.
+  // GPUSTAT is the exception, since the line parity bit changes without an event, so don't skip past the next line.
+  u32 skip_to = g_state.downcount;
+  const Instruction* instructions = block->Instructions();
+  for (u32 i = 0; i < block->size; i++)
+  {
+    const Instruction inst = instructions[i];
+    if (!IsMemoryLoadInstruction(inst))
+      continue;
+
+    const VirtualMemoryAddress address = GetLoadStoreEffectiveAddress(inst, &g_state.regs).value();
+    const PhysicalMemoryAddress paddr = VirtualAddressToPhysical(address);
+    if (Bus::IsRAMAddress(paddr) || (address & SCRATCHPAD_ADDR_MASK) == SCRATCHPAD_ADDR ||
+        (paddr >= Bus::BIOS_BASE && paddr < (Bus::BIOS_BASE + Bus::BIOS_MIRROR_SIZE)) ||
+        (paddr & ~Bus::INTERRUPT_CONTROLLER_MASK) == Bus::INTC_BASE)
+    {
+      continue;
+    }
+    else if ((paddr & ~3u) == (Bus::GPU_BASE + 4))
+    {
+      skip_to = std::min(skip_to, g_state.pending_ticks + static_cast<u32>(g_gpu->GetSystemTicksUntilNextScanline()));
+      continue;
+    }
+
+    return;
+  }
+
+  if (skip_to > g_state.pending_ticks)
+    g_state.pending_ticks = skip_to;
+}
+
+void CPU::CodeCache::SkipIdleLoop()
+{
+  const Block* block = LookupBlock(g_state.pc);
+  if (block && block->HasFlag(BlockFlags::IsIdleLoop)) [[likely]]
+    TrySkipIdleLoop(block);
+}
+
 void CPU::CodeCache::CopyRegInfo(InstructionInfo* dst, const InstructionInfo* src)
 {
   std::memcpy(dst->reg_flags, src->reg_flags, sizeof(dst->reg_flags));
@@ -1330,6 +1559,15 @@ void CPU::CodeCache::CompileOrRevalidateBlock(u32 start_pc)
       RemoveBackpatchInfoForRange(block->host_code, block->host_code_size);
   }
 
+  if (IsHLEKernelCallVector(start_pc)) [[unlikely]]
+  {
+    DEV_LOG("Using interpreter for kernel call vector at 0x{:08X}", start_pc);
+    SetCodeLUT(start_pc, g_interpret_block);
+    BacklinkBlocks(start_pc, g_interpret_block);
+    MemMap::EndCodeWrite();
+    return;
+  }
+
   BlockMetadata metadata = {};
   if (!ReadBlockInstructions(start_pc, &s_block_instructions, &metadata))
   {
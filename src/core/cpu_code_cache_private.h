@@ -91,6 +91,7 @@ enum class BlockFlags : u8
   BranchDelaySpansPages = (1 << 2),
   IsUsingICache = (1 << 3),
   NeedsDynamicFetchTicks = (1 << 4),
+  IsIdleLoop = (1 << 5),
 };
 IMPLEMENT_ENUM_CLASS_BITWISE_OPERATORS(BlockFlags);
 
@@ -215,6 +216,10 @@ void InterpretUncachedBlock();
 
 void LogCurrentState();
 
+/// Fast-forwards to the next event if the block at the current PC is an idle loop, and would spin until then.
+/// Called by recompiled blocks when they branch back to themselves.
+void SkipIdleLoop();
+
 #if defined(_DEBUG) || false
 // Enable disassembly of host assembly code.
 #define ENABLE_HOST_DISASSEMBLY 1
@@ -818,6 +818,128 @@ void CPU::HandleB0Syscall()
     HandlePutsSyscall();
 }
 
+u8* CPU::GetHLEMemoryPointer(VirtualMemoryAddress address, u32 length)
+{
+  // Only ranges which are entirely within RAM without wrapping are handled, anything else goes to the BIOS.
+  const u32 seg = (address >> 29);
+  if ((seg != 0 && seg != 4 && seg != 5) || (address & PHYSICAL_MEMORY_ADDRESS_MASK) >= Bus::RAM_MIRROR_END ||
+      length > Bus::g_ram_size)
+  {
+    return nullptr;
+  }
+
+  const u32 offset = address & Bus::g_ram_mask;
+  return ((offset + length) <= Bus::g_ram_size) ? &Bus::g_unprotected_ram[offset] : nullptr;
+}
+
+void CPU::InvalidateHLEMemoryWrite(VirtualMemoryAddress address, u32 length)
+{
+  const u32 offset = address & Bus::g_ram_mask;
+  const u32 end_page = (offset + length - 1) / HOST_PAGE_SIZE;
+  for (u32 page = offset / HOST_PAGE_SIZE; page <= end_page; page++)
+  {
+    if (Bus::g_ram_code_bits[page])
+      CPU::CodeCache::InvalidateBlocksWithPageIndex(page);
+  }
+}
+
+bool CPU::HandleHLEA0Call()
+{
+  // Approximate cost of the BIOS implementations, which loop a byte at a time.
+  static constexpr TickCount CALL_TICKS = 20;
+  static constexpr TickCount TICKS_PER_BYTE = 8;
+
+  // The arguments could still be in a load delay slot.
+  FlushLoadDelay();
+
+  auto& regs = g_state.regs;
+
+  // Games can patch the A0 table in RAM, only replace the call when it still goes to the BIOS implementation.
+  u32 table_entry;
+  std::memcpy(&table_entry, &Bus::g_unprotected_ram[(0x200 + (regs.t1 & 0xFF) * 4) & Bus::g_ram_mask],
+              sizeof(table_entry));
+  if ((table_entry & PHYSICAL_MEMORY_ADDRESS_MASK) < Bus::BIOS_BASE ||
+      (table_entry & PHYSICAL_MEMORY_ADDRESS_MASK) >= (Bus::BIOS_BASE + Bus::BIOS_SIZE))
+  {
+    return false;
+  }
+
+  u32 length;
+  switch (regs.t1)
+  {
+    case 0x1B: // strlen(src)
+    {
+      const u8* src;
+      if (regs.a0 == 0 || !(src = GetHLEMemoryPointer(regs.a0, 1)))
+        return false;
+
+      const u8* end = static_cast<const u8*>(
+        std::memchr(src, 0, static_cast<size_t>((Bus::g_unprotected_ram + Bus::g_ram_size) - src)));
+      if (!end)
+        return false;
+
+      length = static_cast<u32>(end - src);
+      DEBUG_LOG("HLE strlen(0x{:08X}) = {}", regs.a0, length);
+      regs.v0 = length;
+    }
+    break;
+
+    case 0x28: // bzero(dst, len)
+    case 0x2B: // memset(dst, fillbyte, len)
+    {
+      const bool is_bzero = (regs.t1 == 0x28);
+      const u8 value = is_bzero ? 0 : Truncate8(regs.a1);
+      length = is_bzero ? regs.a1 : regs.a2;
+
+      u8* dst;
+      if (regs.a0 == 0 || static_cast<s32>(length) <= 0 || !(dst = GetHLEMemoryPointer(regs.a0, length)))
+        return false;
+
+      DEBUG_LOG("HLE memset(0x{:08X}, 0x{:02X}, {})", regs.a0, value, length);
+      std::memset(dst, value, length);
+      InvalidateHLEMemoryWrite(regs.a0, length);
+      regs.v0 = regs.a0;
+    }
+    break;
+
+    case 0x2A: // memcpy(dst, src, len)
+    {
+      length = regs.a2;
+
+      u8* dst;
+      const u8* src;
+      if (regs.a0 == 0 || regs.a1 == 0 || static_cast<s32>(length) <= 0 ||
+          !(dst = GetHLEMemoryPointer(regs.a0, length)) || !(src = GetHLEMemoryPointer(regs.a1, length)))
+      {
+        return false;
+      }
+
+      DEBUG_LOG("HLE memcpy(0x{:08X}, 0x{:08X}, {})", regs.a0, regs.a1, length);
+
+      // The BIOS copies forwards, which repeats the start of the source when the destination overlaps it.
+      if (dst > src && dst < (src + length))
+      {
+        for (u32 i = 0; i < length; i++)
+          dst[i] = src[i];
+      }
+      else
+      {
+        std::memmove(dst, src, length);
+      }
+
+      InvalidateHLEMemoryWrite(regs.a0, length);
+      regs.v0 = regs.a0;
+    }
+    break;
+
+    default:
+      return false;
+  }
+
+  AddPendingTicks(CALL_TICKS + static_cast<TickCount>(length) * TICKS_PER_BYTE);
+  return true;
+}
+
 const std::array<CPU::DebuggerRegisterListEntry, CPU::NUM_DEBUGGER_REGISTER_LIST_ENTRIES>
   CPU::g_debugger_register_list = {{{"zero", &CPU::g_state.regs.zero},
                                     {"at", &CPU::g_state.regs.at},
@@ -2008,7 +2130,8 @@ bool CPU::UpdateDebugDispatcherFlag()
 
   const bool use_debug_dispatcher =
     has_any_breakpoints || has_cop0_breakpoints || s_trace_to_log ||
-    (g_settings.cpu_execution_mode == CPUExecutionMode::Interpreter && g_settings.bios_tty_logging);
+    (g_settings.cpu_execution_mode == CPUExecutionMode::Interpreter &&
+     (g_settings.bios_tty_logging || g_settings.bios_hle_memory_routines));
   if (use_debug_dispatcher == g_state.using_debug_dispatcher)
     return false;
 
@@ -2423,9 +2546,22 @@ template<PGXPMode pgxp_mode, bool debug>
           LogInstruction(g_state.current_instruction.bits, g_state.current_instruction_pc, true);
 
         if (g_state.current_instruction_pc == 0xA0) [[unlikely]]
-          HandleA0Syscall();
-        else if (g_state.current_instruction_pc == 0xB0) [[unlikely]]
+        {
+          if (g_settings.bios_tty_logging)
+            HandleA0Syscall();
+
+          // Return straight to the caller if the call was executed natively.
+          if (IsHLEKernelCallVector(g_state.current_instruction_pc) && HandleHLEA0Call())
+          {
+            g_state.npc = g_state.regs.ra;
+            FlushPipeline();
+            continue;
+          }
+        }
+        else if (g_state.current_instruction_pc == 0xB0 && g_settings.bios_tty_logging) [[unlikely]]
+        {
           HandleB0Syscall();
+        }
       }
 
 #if 0 // GTE flag test debugging
@@ -2563,6 +2699,19 @@ template void CPU::CodeCache::InterpretCachedBlock<PGXPMode::CPU>(const Block* b
 template<PGXPMode pgxp_mode>
 void CPU::CodeCache::InterpretUncachedBlock()
 {
+  // Kernel call vector is never compiled when HLE is enabled, so it can be intercepted here.
+  if (IsHLEKernelCallVector(g_state.pc)) [[unlikely]]
+  {
+    if (g_settings.bios_tty_logging)
+      HandleA0Syscall();
+
+    if (HandleHLEA0Call())
+    {
+      g_state.pc = g_state.regs.ra;
+      return;
+    }
+  }
+
   g_state.npc = g_state.pc;
   if (!FetchInstructionForInterpreterFallback())
     return;
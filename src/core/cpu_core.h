@@ -185,6 +185,11 @@ bool SafeWriteMemoryHalfWord(VirtualMemoryAddress addr, u16 value);
 bool SafeWriteMemoryWord(VirtualMemoryAddress addr, u32 value);
 bool SafeWriteMemoryBytes(VirtualMemoryAddress addr, const void* data, u32 length);
 
+// Direct access to RAM for HLE routines. Returns nullptr if the range is not entirely within RAM. Writes through the
+// pointer must be followed by InvalidateHLEMemoryWrite(), so that any code in the range is recompiled.
+u8* GetHLEMemoryPointer(VirtualMemoryAddress address, u32 length);
+void InvalidateHLEMemoryWrite(VirtualMemoryAddress address, u32 length);
+
 // External IRQs
 void SetIRQRequest(bool state);
 
@@ -4,6 +4,7 @@
 #pragma once
 #include "bus.h"
 #include "cpu_core.h"
+#include "settings.h"
 
 namespace CPU {
 
@@ -126,4 +127,14 @@ ALWAYS_INLINE static void StallUntilGTEComplete()
 void HandleA0Syscall();
 void HandleB0Syscall();
 
+/// Returns true if the PC is the A0 kernel call vector, and the memory routines in it should be intercepted.
+ALWAYS_INLINE static bool IsHLEKernelCallVector(VirtualMemoryAddress pc)
+{
+  return (g_settings.bios_hle_memory_routines && (pc & PHYSICAL_MEMORY_ADDRESS_MASK) == 0xA0);
+}
+
+/// Executes A0 memory routines natively. Returns true if the call was handled, in which case the result is in v0,
+/// and execution should continue from the return address. Otherwise the BIOS implementation should be executed.
+bool HandleHLEA0Call();
+
 } // namespace CPU
\ No newline at end of file
@@ -1718,9 +1718,17 @@ void CPU::NewRec::Compiler::CompileLoadStoreTemplate(void (Compiler::*func)(Comp
 void CPU::NewRec::Compiler::TruncateBlock()
 {
   m_block->size = ((m_current_instruction_pc - m_block->pc) / sizeof(Instruction)) + 1;
+  m_block->flags &= ~CodeCache::BlockFlags::IsIdleLoop;
   iinfo->is_last_instruction = true;
 }
 
+void CPU::NewRec::Compiler::GenerateIdleLoopSkip(const std::optional<u32>& newpc)
+{
+  // Registers must already be flushed, since the loads are checked against the values in the CPU state.
+  if (newpc.has_value() && newpc.value() == m_block->pc && m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+    GenerateCall(reinterpret_cast<const void*>(&CPU::CodeCache::SkipIdleLoop));
+}
+
 const TickCount* CPU::NewRec::Compiler::GetFetchMemoryAccessTimePtr() const
 {
   const TickCount* ptr =
@@ -202,6 +202,7 @@ protected:
   bool TrySwapDelaySlot(Reg rs = Reg::zero, Reg rt = Reg::zero, Reg rd = Reg::zero);
   void SetCompilerPC(u32 newpc);
   void TruncateBlock();
+  void GenerateIdleLoopSkip(const std::optional<u32>& newpc);
 
   const TickCount* GetFetchMemoryAccessTimePtr() const;
 
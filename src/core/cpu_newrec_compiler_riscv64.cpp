@@ -625,6 +625,7 @@ void CPU::NewRec::RISCV64Compiler::EndBlock(const std::optional<u32>& newpc, boo
 
   // flush regs
   Flush(FLUSH_END_BLOCK);
+  GenerateIdleLoopSkip(newpc);
   EndAndLinkBlock(newpc, do_event_test, false);
 }
 
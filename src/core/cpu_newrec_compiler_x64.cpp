@@ -243,6 +243,7 @@ void CPU::NewRec::X64Compiler::EndBlock(const std::optional<u32>& newpc, bool do
 
   // flush regs
   Flush(FLUSH_END_BLOCK);
+  GenerateIdleLoopSkip(newpc);
   EndAndLinkBlock(newpc, do_event_test, false);
 }
 
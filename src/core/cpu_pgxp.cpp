@@ -12,6 +12,7 @@
 #include "settings.h"
 
 #include "util/gpu_device.h"
+#include "util/memory_usage.h"
 
 #include "common/assert.h"
 #include "common/log.h"
@@ -137,6 +138,8 @@ void CPU::PGXP::Initialize()
     s_mem = static_cast<PGXPValue*>(std::calloc(PGXP_MEM_SIZE, sizeof(PGXPValue)));
     if (!s_mem)
       Panic("Failed to allocate PGXP memory");
+
+    MemoryUsage::Add(MemoryUsage::Category::PGXP, sizeof(PGXPValue) * PGXP_MEM_SIZE);
   }
 
   if (g_settings.gpu_pgxp_vertex_cache && !s_vertex_cache)
@@ -147,6 +150,10 @@ void CPU::PGXP::Initialize()
       ERROR_LOG("Failed to allocate memory for vertex cache, disabling.");
       g_settings.gpu_pgxp_vertex_cache = false;
     }
+    else
+    {
+      MemoryUsage::Add(MemoryUsage::Category::PGXP, sizeof(PGXPValue) * VERTEX_CACHE_SIZE);
+    }
   }
 
   if (s_vertex_cache)
@@ -172,11 +179,13 @@ void CPU::PGXP::Shutdown()
   {
     std::free(s_vertex_cache);
     s_vertex_cache = nullptr;
+    MemoryUsage::Remove(MemoryUsage::Category::PGXP, sizeof(PGXPValue) * VERTEX_CACHE_SIZE);
   }
   if (s_mem)
   {
     std::free(s_mem);
     s_mem = nullptr;
+    MemoryUsage::Remove(MemoryUsage::Category::PGXP, sizeof(PGXPValue) * PGXP_MEM_SIZE);
   }
 
   std::memset(g_state.pgxp_gte, 0, sizeof(g_state.pgxp_gte));
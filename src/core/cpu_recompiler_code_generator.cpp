@@ -2448,10 +2448,16 @@ bool CodeGenerator::Compile_Branch(Instruction instruction, const CodeCache::Ins
           EmitConditionalBranch(Condition::GreaterEqual, false, pending_ticks.GetHostRegister(), downcount,
                                 &return_to_dispatcher);
 
+          DebugAssert(branch_target.IsConstant());
+          if (static_cast<u32>(branch_target.constant_value) == m_block->pc &&
+              m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+          {
+            EmitFunctionCall(nullptr, &CodeCache::SkipIdleLoop);
+          }
+
           // we're committed at this point :D
           EmitEndBlock(true, nullptr);
 
-          DebugAssert(branch_target.IsConstant());
           if (static_cast<u32>(branch_target.constant_value) == m_block->pc)
           {
             // self-link
@@ -2484,10 +2490,16 @@ bool CodeGenerator::Compile_Branch(Instruction instruction, const CodeCache::Ins
       EmitConditionalBranch(Condition::GreaterEqual, false, pending_ticks.GetHostRegister(), downcount,
                             &return_to_dispatcher);
 
-      EmitEndBlock(true, nullptr);
-
       const Value& jump_target = (condition != Condition::Always) ? constant_next_pc : branch_target;
       DebugAssert(jump_target.IsConstant());
+      if (static_cast<u32>(jump_target.constant_value) == m_block->pc &&
+          m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+      {
+        EmitFunctionCall(nullptr, &CodeCache::SkipIdleLoop);
+      }
+
+      EmitEndBlock(true, nullptr);
+
       if (static_cast<u32>(jump_target.constant_value) == m_block->pc)
       {
         // self-link
@@ -0,0 +1,689 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#include "fingerprint_cache.h"
+#include "settings.h"
+
+#include "util/cd_image.h"
+
+#include "common/assert.h"
+#include "common/binary_reader_writer.h"
+#include "common/error.h"
+#include "common/file_system.h"
+#include "common/heterogeneous_containers.h"
+#include "common/log.h"
+#include "common/path.h"
+#include "common/timer.h"
+
+#include "fmt/format.h"
+
+#include <limits>
+#include <mutex>
+#include <optional>
+
+Log_SetChannel(FingerprintCache);
+
+namespace FingerprintCache {
+namespace {
+
+enum : u32
+{
+  FINGERPRINT_CACHE_SIGNATURE = 0x50474946,
+  FINGERPRINT_CACHE_VERSION = 2,
+
+  // Rewrite the file when it contains this many more records than live values.
+  COMPACT_THRESHOLD = 256,
+};
+
+enum class RecordType : u8
+{
+  BIOSHash,
+  GameDetails,
+  AchievementsHash,
+  TrackHashes,
+  Count
+};
+
+struct FileKey
+{
+  s64 size;
+  s64 modification_time;
+  u64 inode;
+
+  ALWAYS_INLINE bool operator==(const FileKey& rhs) const
+  {
+    return (size == rhs.size && modification_time == rhs.modification_time && inode == rhs.inode);
+  }
+  ALWAYS_INLINE bool operator!=(const FileKey& rhs) const { return !operator==(rhs); }
+};
+
+struct SourceFile
+{
+  std::string path;
+  FileKey key;
+};
+
+struct Entry
+{
+  std::vector<SourceFile> files;
+  u32 subimage;
+
+  std::optional<Hash> bios_hash;
+  bool is_openbios = false;
+
+  std::optional<u64> game_hash;
+  std::string game_id;
+
+  std::optional<std::string> achievements_hash;
+  std::optional<std::vector<Hash>> track_hashes;
+
+  bool HasValue(RecordType type) const
+  {
+    switch (type)
+    {
+      case RecordType::BIOSHash:
+        return bios_hash.has_value();
+      case RecordType::GameDetails:
+        return game_hash.has_value();
+      case RecordType::AchievementsHash:
+        return achievements_hash.has_value();
+      case RecordType::TrackHashes:
+        return track_hashes.has_value();
+      default:
+        return false;
+    }
+  }
+
+  u32 GetValueCount() const
+  {
+    return static_cast<u32>(bios_hash.has_value()) + static_cast<u32>(game_hash.has_value()) +
+           static_cast<u32>(achievements_hash.has_value()) + static_cast<u32>(track_hashes.has_value());
+  }
+};
+
+} // namespace
+
+using EntryMap = PreferUnorderedStringMap<Entry>;
+
+static std::string GetCacheFileName();
+static std::string MakeEntryKey(std::span<const SourceFile> files, u32 subimage);
+static bool GetFileKey(const char* path, FileKey* key);
+static bool GetSourceFileKeys(std::span<const std::string> paths, std::vector<SourceFile>* files);
+static bool SourceFilesMatch(std::span<const SourceFile> lhs, std::span<const SourceFile> rhs);
+static Entry* LookupEntry(std::span<const std::string> paths, u32 subimage);
+static Entry* GetOrCreateEntry(std::span<const std::string> paths, u32 subimage);
+static u32 GetImageSubImage(const CDImage* image);
+
+static void EnsureLoaded();
+static bool LoadCacheFile(std::FILE* fp, u32* record_count);
+static bool ReadRecord(BinaryFileReader& reader);
+static bool WriteRecord(BinaryFileWriter& writer, const Entry& entry, RecordType type);
+static void WriteEntryRecords(BinaryFileWriter& writer, const Entry& entry);
+static void AppendRecord(const Entry& entry, RecordType type);
+static void AppendRecords(std::span<const std::pair<const Entry*, RecordType>> records);
+static bool RewriteCacheFile(std::FILE* fp);
+
+static std::mutex s_mutex;
+static EntryMap s_entries;
+static bool s_loaded = false;
+
+static u32 s_batch_depth = 0;
+static std::vector<std::pair<std::string, RecordType>> s_pending_records;
+
+} // namespace FingerprintCache
+
+std::string FingerprintCache::GetCacheFileName()
+{
+  return EmuFolders::Cache.empty() ? std::string() : Path::Combine(EmuFolders::Cache, "fingerprints.cache");
+}
+
+std::string FingerprintCache::MakeEntryKey(std::span<const SourceFile> files, u32 subimage)
+{
+  // Patches are part of the key, so that patched and unpatched opens of the same image don't evict each other.
+  std::string key;
+  for (const SourceFile& file : files)
+  {
+    if (!key.empty())
+      key += '|';
+    key += file.path;
+  }
+  if (subimage != 0)
+    fmt::format_to(std::back_inserter(key), ":{}", subimage);
+  return key;
+}
+
+bool FingerprintCache::GetFileKey(const char* path, FileKey* key)
+{
+  // st_ino is always zero on Windows, so only the size and timestamp are checked there.
+  struct stat st;
+  if (!FileSystem::StatFile(path, &st))
+    return false;
+
+  key->size = static_cast<s64>(st.st_size);
+  key->modification_time = static_cast<s64>(st.st_mtime);
+  key->inode = static_cast<u64>(st.st_ino);
+  return true;
+}
+
+bool FingerprintCache::GetSourceFileKeys(std::span<const std::string> paths, std::vector<SourceFile>* files)
+{
+  // File count is stored as a byte.
+  files->clear();
+  if (paths.empty() || paths.size() > std::numeric_limits<u8>::max())
+    return false;
+
+  files->reserve(paths.size());
+  for (const std::string& path : paths)
+  {
+    SourceFile& file = files->emplace_back();
+    file.path = path;
+    if (path.empty() || !GetFileKey(path.c_str(), &file.key))
+      return false;
+  }
+
+  return true;
+}
+
+bool FingerprintCache::SourceFilesMatch(std::span<const SourceFile> lhs, std::span<const SourceFile> rhs)
+{
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                    [](const SourceFile& l, const SourceFile& r) { return (l.path == r.path && l.key == r.key); });
+}
+
+u32 FingerprintCache::GetImageSubImage(const CDImage* image)
+{
+  return image->HasSubImages() ? image->GetCurrentSubImage() : 0;
+}
+
+FingerprintCache::Entry* FingerprintCache::LookupEntry(std::span<const std::string> paths, u32 subimage)
+{
+  EnsureLoaded();
+
+  std::vector<SourceFile> files;
+  if (!GetSourceFileKeys(paths, &files))
+    return nullptr;
+
+  const auto iter = s_entries.find(MakeEntryKey(files, subimage));
+  if (iter == s_entries.end())
+    return nullptr;
+
+  // Track files and patches can change without touching the descriptor, so every file has to match.
+  if (!SourceFilesMatch(files, iter->second.files))
+  {
+    DEV_LOG("Discarding stale fingerprint for '{}'", iter->first);
+    s_entries.erase(iter);
+    return nullptr;
+  }
+
+  return &iter->second;
+}
+
+FingerprintCache::Entry* FingerprintCache::GetOrCreateEntry(std::span<const std::string> paths, u32 subimage)
+{
+  EnsureLoaded();
+
+  std::vector<SourceFile> files;
+  if (!GetSourceFileKeys(paths, &files))
+    return nullptr;
+
+  std::string entry_key = MakeEntryKey(files, subimage);
+  auto iter = s_entries.find(entry_key);
+  if (iter != s_entries.end())
+  {
+    if (SourceFilesMatch(files, iter->second.files))
+      return &iter->second;
+
+    s_entries.erase(iter);
+  }
+
+  Entry entry;
+  entry.files = std::move(files);
+  entry.subimage = subimage;
+  return &s_entries.emplace(std::move(entry_key), std::move(entry)).first->second;
+}
+
+void FingerprintCache::EnsureLoaded()
+{
+  if (s_loaded)
+    return;
+
+  s_loaded = true;
+
+  const std::string filename = GetCacheFileName();
+  if (filename.empty())
+    return;
+
+  Error error;
+  FileSystem::ManagedCFilePtr fp = FileSystem::OpenExistingOrCreateManagedCFile(filename.c_str(), 0, &error);
+  if (!fp)
+  {
+    ERROR_LOG("Failed to open fingerprint cache: {}", error.GetDescription());
+    return;
+  }
+
+#ifndef _WIN32
+  FileSystem::POSIXLock file_lock(fp.get());
+#endif
+
+  Common::Timer timer;
+  u32 record_count = 0;
+  if (!LoadCacheFile(fp.get(), &record_count))
+  {
+    WARNING_LOG("Initializing fingerprint cache.");
+    s_entries.clear();
+    RewriteCacheFile(fp.get());
+    return;
+  }
+
+  // Superseded records pile up since the file is append-only, so compact it when they start to dominate.
+  u32 live_count = 0;
+  for (const auto& it : s_entries)
+    live_count += it.second.GetValueCount();
+  if (record_count > (live_count + COMPACT_THRESHOLD))
+  {
+    INFO_LOG("Compacting fingerprint cache from {} to {} records.", record_count, live_count);
+    RewriteCacheFile(fp.get());
+  }
+
+  VERBOSE_LOG("Loaded {} fingerprints in {:.2f}ms.", s_entries.size(), timer.GetTimeMilliseconds());
+}
+
+bool FingerprintCache::LoadCacheFile(std::FILE* fp, u32* record_count)
+{
+  BinaryFileReader reader(fp);
+  if (reader.IsAtEnd())
+    return false;
+
+  u32 file_signature, file_version;
+  if (!reader.ReadU32(&file_signature) || !reader.ReadU32(&file_version) ||
+      file_signature != FINGERPRINT_CACHE_SIGNATURE || file_version != FINGERPRINT_CACHE_VERSION)
+  {
+    WARNING_LOG("Fingerprint cache is corrupted");
+    return false;
+  }
+
+  while (!reader.IsAtEnd())
+  {
+    if (!ReadRecord(reader))
+    {
+      WARNING_LOG("Fingerprint cache record is corrupted");
+      return false;
+    }
+
+    (*record_count)++;
+  }
+
+  return true;
+}
+
+bool FingerprintCache::ReadRecord(BinaryFileReader& reader)
+{
+  u8 type;
+  u32 subimage;
+  u8 file_count;
+  if (!reader.ReadU8(&type) || !reader.ReadU32(&subimage) || !reader.ReadU8(&file_count) || file_count == 0 ||
+      type >= static_cast<u8>(RecordType::Count))
+  {
+    return false;
+  }
+
+  std::vector<SourceFile> files(file_count);
+  for (SourceFile& file : files)
+  {
+    if (!reader.ReadSizePrefixedString(&file.path) || !reader.ReadS64(&file.key.size) ||
+        !reader.ReadS64(&file.key.modification_time) || !reader.ReadU64(&file.key.inode))
+    {
+      return false;
+    }
+  }
+
+  // Later records win, including ones written after the file changed on disk.
+  std::string entry_key = MakeEntryKey(files, subimage);
+  auto iter = s_entries.find(entry_key);
+  if (iter == s_entries.end() || !SourceFilesMatch(files, iter->second.files))
+  {
+    Entry entry;
+    entry.files = std::move(files);
+    entry.subimage = subimage;
+    if (iter != s_entries.end())
+      iter->second = std::move(entry);
+    else
+      iter = s_entries.emplace(std::move(entry_key), std::move(entry)).first;
+  }
+
+  Entry& entry = iter->second;
+  switch (static_cast<RecordType>(type))
+  {
+    case RecordType::BIOSHash:
+    {
+      Hash hash;
+      if (!reader.Read(hash.data(), hash.size()) || !reader.ReadBool(&entry.is_openbios))
+        return false;
+      entry.bios_hash = hash;
+    }
+    break;
+
+    case RecordType::GameDetails:
+    {
+      u64 hash;
+      if (!reader.ReadSizePrefixedString(&entry.game_id) || !reader.ReadU64(&hash))
+        return false;
+      entry.game_hash = hash;
+    }
+    break;
+
+    case RecordType::AchievementsHash:
+    {
+      std::string hash;
+      if (!reader.ReadSizePrefixedString(&hash))
+        return false;
+      entry.achievements_hash = std::move(hash);
+    }
+    break;
+
+    case RecordType::TrackHashes:
+    {
+      u8 count;
+      if (!reader.ReadU8(&count))
+        return false;
+
+      std::vector<Hash> hashes(count);
+      for (Hash& hash : hashes)
+      {
+        if (!reader.Read(hash.data(), hash.size()))
+          return false;
+      }
+      entry.track_hashes = std::move(hashes);
+    }
+    break;
+
+      DefaultCaseIsUnreachable();
+  }
+
+  return true;
+}
+
+bool FingerprintCache::WriteRecord(BinaryFileWriter& writer, const Entry& entry, RecordType type)
+{
+  writer.WriteU8(static_cast<u8>(type));
+  writer.WriteU32(entry.subimage);
+  writer.WriteU8(static_cast<u8>(entry.files.size()));
+  for (const SourceFile& file : entry.files)
+  {
+    writer.WriteSizePrefixedString(file.path);
+    writer.WriteS64(file.key.size);
+    writer.WriteS64(file.key.modification_time);
+    writer.WriteU64(file.key.inode);
+  }
+
+  switch (type)
+  {
+    case RecordType::BIOSHash:
+    {
+      writer.Write(entry.bios_hash->data(), entry.bios_hash->size());
+      writer.WriteBool(entry.is_openbios);
+    }
+    break;
+
+    case RecordType::GameDetails:
+    {
+      writer.WriteSizePrefixedString(entry.game_id);
+      writer.WriteU64(entry.game_hash.value());
+    }
+    break;
+
+    case RecordType::AchievementsHash:
+    {
+      writer.WriteSizePrefixedString(entry.achievements_hash.value());
+    }
+    break;
+
+    case RecordType::TrackHashes:
+    {
+      writer.WriteU8(static_cast<u8>(entry.track_hashes->size()));
+      for (const Hash& hash : entry.track_hashes.value())
+        writer.Write(hash.data(), hash.size());
+    }
+    break;
+
+      DefaultCaseIsUnreachable();
+  }
+
+  return writer.IsGood();
+}
+
+void FingerprintCache::WriteEntryRecords(BinaryFileWriter& writer, const Entry& entry)
+{
+  if (entry.bios_hash.has_value())
+    WriteRecord(writer, entry, RecordType::BIOSHash);
+  if (entry.game_hash.has_value())
+    WriteRecord(writer, entry, RecordType::GameDetails);
+  if (entry.achievements_hash.has_value())
+    WriteRecord(writer, entry, RecordType::AchievementsHash);
+  if (entry.track_hashes.has_value())
+    WriteRecord(writer, entry, RecordType::TrackHashes);
+}
+
+bool FingerprintCache::RewriteCacheFile(std::FILE* fp)
+{
+  Error error;
+  if (!FileSystem::FSeek64(fp, 0, SEEK_SET, &error) || !FileSystem::FTruncate64(fp, 0, &error))
+  {
+    ERROR_LOG("Failed to truncate fingerprint cache: {}", error.GetDescription());
+    return false;
+  }
+
+  BinaryFileWriter writer(fp);
+  writer.WriteU32(FINGERPRINT_CACHE_SIGNATURE);
+  writer.WriteU32(FINGERPRINT_CACHE_VERSION);
+  for (const auto& it : s_entries)
+    WriteEntryRecords(writer, it.second);
+
+  if (!writer.Flush(&error))
+  {
+    ERROR_LOG("Failed to write fingerprint cache: {}", error.GetDescription());
+    return false;
+  }
+
+  return true;
+}
+
+void FingerprintCache::AppendRecord(const Entry& entry, RecordType type)
+{
+  if (s_batch_depth > 0)
+  {
+    s_pending_records.emplace_back(MakeEntryKey(entry.files, entry.subimage), type);
+    return;
+  }
+
+  const std::pair<const Entry*, RecordType> record(&entry, type);
+  AppendRecords(std::span<const std::pair<const Entry*, RecordType>>(&record, 1));
+}
+
+void FingerprintCache::AppendRecords(std::span<const std::pair<const Entry*, RecordType>> records)
+{
+  const std::string filename = GetCacheFileName();
+  if (filename.empty())
+    return;
+
+  Error error;
+  FileSystem::ManagedCFilePtr fp = FileSystem::OpenExistingOrCreateManagedCFile(filename.c_str(), 0, &error);
+  if (!fp)
+  {
+    ERROR_LOG("Failed to open fingerprint cache: {}", error.GetDescription());
+    return;
+  }
+
+#ifndef _WIN32
+  FileSystem::POSIXLock file_lock(fp.get());
+#endif
+
+  // Another instance may have initialized the file in the meantime, only write a header if it's empty.
+  BinaryFileWriter writer(fp.get());
+  if (!FileSystem::FSeek64(fp.get(), 0, SEEK_END, &error))
+  {
+    ERROR_LOG("Failed to seek fingerprint cache: {}", error.GetDescription());
+    return;
+  }
+  if (FileSystem::FTell64(fp.get()) == 0)
+  {
+    writer.WriteU32(FINGERPRINT_CACHE_SIGNATURE);
+    writer.WriteU32(FINGERPRINT_CACHE_VERSION);
+  }
+
+  for (const auto& [entry, type] : records)
+    WriteRecord(writer, *entry, type);
+
+  if (!writer.Flush(&error)) [[unlikely]]
+    WARNING_LOG("Failed to write {} fingerprints: {}", records.size(), error.GetDescription());
+}
+
+bool FingerprintCache::GetBIOSHash(const char* path, Hash* hash, bool* is_openbios)
+{
+  std::unique_lock lock(s_mutex);
+  const std::string paths[] = {path};
+  const Entry* entry = LookupEntry(paths, 0);
+  if (!entry || !entry->bios_hash.has_value())
+    return false;
+
+  *hash = entry->bios_hash.value();
+  *is_openbios = entry->is_openbios;
+  return true;
+}
+
+void FingerprintCache::SetBIOSHash(const char* path, const Hash& hash, bool is_openbios)
+{
+  std::unique_lock lock(s_mutex);
+  const std::string paths[] = {path};
+  Entry* entry = GetOrCreateEntry(paths, 0);
+  if (!entry)
+    return;
+
+  entry->bios_hash = hash;
+  entry->is_openbios = is_openbios;
+  AppendRecord(*entry, RecordType::BIOSHash);
+}
+
+bool FingerprintCache::GetGameDetails(const CDImage* image, std::string* id, u64* hash)
+{
+  std::unique_lock lock(s_mutex);
+  const Entry* entry = LookupEntry(image->GetSourceFiles(), GetImageSubImage(image));
+  if (!entry || !entry->game_hash.has_value())
+    return false;
+
+  if (id)
+    *id = entry->game_id;
+  if (hash)
+    *hash = entry->game_hash.value();
+  return true;
+}
+
+void FingerprintCache::SetGameDetails(const CDImage* image, std::string_view id, u64 hash)
+{
+  std::unique_lock lock(s_mutex);
+  Entry* entry = GetOrCreateEntry(image->GetSourceFiles(), GetImageSubImage(image));
+  if (!entry)
+    return;
+
+  entry->game_id = id;
+  entry->game_hash = hash;
+  AppendRecord(*entry, RecordType::GameDetails);
+}
+
+bool FingerprintCache::GetAchievementsHash(const CDImage* image, std::string* hash)
+{
+  std::unique_lock lock(s_mutex);
+  const Entry* entry = LookupEntry(image->GetSourceFiles(), GetImageSubImage(image));
+  if (!entry || !entry->achievements_hash.has_value())
+    return false;
+
+  *hash = entry->achievements_hash.value();
+  return true;
+}
+
+void FingerprintCache::SetAchievementsHash(const CDImage* image, std::string_view hash)
+{
+  std::unique_lock lock(s_mutex);
+  Entry* entry = GetOrCreateEntry(image->GetSourceFiles(), GetImageSubImage(image));
+  if (!entry)
+    return;
+
+  entry->achievements_hash = hash;
+  AppendRecord(*entry, RecordType::AchievementsHash);
+}
+
+bool FingerprintCache::GetTrackHashes(const CDImage* image, std::vector<Hash>* hashes)
+{
+  std::unique_lock lock(s_mutex);
+  const Entry* entry = LookupEntry(image->GetSourceFiles(), GetImageSubImage(image));
+  if (!entry || !entry->track_hashes.has_value())
+    return false;
+
+  *hashes = entry->track_hashes.value();
+  return true;
+}
+
+void FingerprintCache::SetTrackHashes(const CDImage* image, std::span<const Hash> hashes)
+{
+  std::unique_lock lock(s_mutex);
+  Entry* entry = GetOrCreateEntry(image->GetSourceFiles(), GetImageSubImage(image));
+  if (!entry)
+    return;
+
+  entry->track_hashes = std::vector<Hash>(hashes.begin(), hashes.end());
+  AppendRecord(*entry, RecordType::TrackHashes);
+}
+
+void FingerprintCache::Clear()
+{
+  std::unique_lock lock(s_mutex);
+  s_entries.clear();
+  s_pending_records.clear();
+  s_loaded = true;
+
+  const std::string filename = GetCacheFileName();
+  if (filename.empty())
+    return;
+
+  Error error;
+  FileSystem::ManagedCFilePtr fp = FileSystem::OpenExistingOrCreateManagedCFile(filename.c_str(), 0, &error);
+  if (!fp)
+  {
+    ERROR_LOG("Failed to open fingerprint cache: {}", error.GetDescription());
+    return;
+  }
+
+#ifndef _WIN32
+  FileSystem::POSIXLock file_lock(fp.get());
+#endif
+
+  RewriteCacheFile(fp.get());
+}
+
+void FingerprintCache::BeginBatch()
+{
+  std::unique_lock lock(s_mutex);
+  s_batch_depth++;
+}
+
+void FingerprintCache::EndBatch()
+{
+  std::unique_lock lock(s_mutex);
+  DebugAssert(s_batch_depth > 0);
+  if ((--s_batch_depth) > 0 || s_pending_records.empty())
+    return;
+
+  // Entries may have been replaced or discarded since the record was queued, so write whatever is current.
+  std::vector<std::pair<const Entry*, RecordType>> records;
+  records.reserve(s_pending_records.size());
+  for (const auto& [key, type] : s_pending_records)
+  {
+    const auto iter = s_entries.find(key);
+    if (iter != s_entries.end() && iter->second.HasValue(type))
+      records.emplace_back(&iter->second, type);
+  }
+  s_pending_records.clear();
+
+  if (!records.empty())
+    AppendRecords(records);
+}
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#pragma once
+
+#include "types.h"
+
+#include <array>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CDImage;
+
+/// Persistent cache of values derived from hashing BIOS and disc images. Entries are keyed on the files the image is
+/// read from (including track files and patches) and subimage, and are discarded when the size, modification time or
+/// inode of any of those files changes.
+namespace FingerprintCache {
+
+using Hash = std::array<u8, 16>;
+
+/// BIOS image hashes, used to identify BIOS files without reading the whole file.
+bool GetBIOSHash(const char* path, Hash* hash, bool* is_openbios);
+void SetBIOSHash(const char* path, const Hash& hash, bool is_openbios);
+
+/// Serial and executable hash from System::GetGameDetailsFromImage().
+bool GetGameDetails(const CDImage* image, std::string* id, u64* hash);
+void SetGameDetails(const CDImage* image, std::string_view id, u64 hash);
+
+/// RetroAchievements hash of the executable.
+bool GetAchievementsHash(const CDImage* image, std::string* hash);
+void SetAchievementsHash(const CDImage* image, std::string_view hash);
+
+/// MD5 of each track, used for verifying dumps against the database.
+bool GetTrackHashes(const CDImage* image, std::vector<Hash>* hashes);
+void SetTrackHashes(const CDImage* image, std::span<const Hash> hashes);
+
+/// Removes all entries, and truncates the cache file.
+void Clear();
+
+/// Holds back writes to the cache file until the matching EndBatch(), so that scans which fingerprint many files
+/// only open and flush it once. Batches can be nested.
+void BeginBatch();
+void EndBatch();
+
+} // namespace FingerprintCache
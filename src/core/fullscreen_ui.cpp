@@ -3434,6 +3434,10 @@ void FullscreenUI::DrawEmulationSettingsPage()
     FSUI_CSTR("Sets the turbo speed. It is not guaranteed that this speed will be reached on all systems."), "Main",
     "TurboSpeed", 2.0f, emulation_speed_titles.data(), emulation_speed_values.data(), emulation_speed_titles.size(),
     true);
+  DrawToggleSetting(
+    bsi, FSUI_ICONSTR(ICON_FA_FORWARD, "Uncapped Turbo"),
+    FSUI_CSTR("Turbo runs as fast as possible, with no audio and the display only updated once per second."), "Main",
+    "TurboUncapped", false);
 
   MenuHeading(FSUI_CSTR("Latency Control"));
   DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_TV, "Vertical Sync (VSync)"),
@@ -3465,6 +3469,13 @@ void FullscreenUI::DrawEmulationSettingsPage()
     !(GetEffectiveBoolSetting(bsi, "Display", "VSync", false) &&
       GetEffectiveBoolSetting(bsi, "Main", "SyncToHostRefreshRate", false)));
 
+  DrawToggleSetting(
+    bsi, FSUI_ICONSTR(ICON_FA_FORWARD, "Automatic Frame Skip"),
+    FSUI_CSTR("Skips rendering of frames when emulation falls behind the target speed."), "Display", "AutoFrameSkip",
+    false,
+    !(GetEffectiveBoolSetting(bsi, "Display", "VSync", false) &&
+      GetEffectiveBoolSetting(bsi, "Main", "SyncToHostRefreshRate", false)));
+
   const bool pre_frame_sleep_active =
     (optimal_frame_pacing_active && GetEffectiveBoolSetting(bsi, "Display", "PreFrameSleep", false));
   DrawFloatRangeSetting(
@@ -4436,6 +4447,13 @@ void FullscreenUI::DrawDisplaySettingsPage()
       FSUI_CSTR("Runs the software renderer in parallel for VRAM readbacks. On some systems, this may result "
                 "in greater performance."),
       "GPU", "UseSoftwareRendererForReadbacks", false);
+
+    const RenderAPI render_api = Settings::GetRenderAPIForRenderer(renderer);
+    DrawToggleSetting(bsi, FSUI_CSTR("Threaded Hardware Rendering"),
+                      FSUI_CSTR("Batches and submits draws for the hardware renderers on a second thread. Not "
+                                "available with OpenGL."),
+                      "GPU", "UseHardwareThread", false,
+                      render_api != RenderAPI::OpenGL && render_api != RenderAPI::OpenGLES);
   }
 
   DrawToggleSetting(
@@ -5215,6 +5233,9 @@ void FullscreenUI::DrawAdvancedSettingsPage()
     bsi, FSUI_CSTR("Enable Recompiler Block Linking"),
     FSUI_CSTR("Performance enhancement - jumps directly between blocks instead of returning to the dispatcher."), "CPU",
     "RecompilerBlockLinking", true);
+  DrawToggleSetting(bsi, FSUI_CSTR("Enable Idle Loop Skipping"),
+                    FSUI_CSTR("Fast-forwards to the next event when the game is waiting in a busy loop."), "CPU",
+                    "IdleLoopSkipping", true);
   DrawEnumSetting(bsi, FSUI_CSTR("Recompiler Fast Memory Access"),
                   FSUI_CSTR("Avoids calls to C++ code, significantly speeding up the recompiler."), "CPU",
                   "FastmemMode", Settings::DEFAULT_CPU_FASTMEM_MODE, &Settings::ParseCPUFastmemMode,
@@ -7246,6 +7267,7 @@ TRANSLATE_NOOP("FullscreenUI", "Audio Backend");
 TRANSLATE_NOOP("FullscreenUI", "Audio Control");
 TRANSLATE_NOOP("FullscreenUI", "Audio Settings");
 TRANSLATE_NOOP("FullscreenUI", "Auto-Detect");
+TRANSLATE_NOOP("FullscreenUI", "Automatic Frame Skip");
 TRANSLATE_NOOP("FullscreenUI", "Automatic Mapping");
 TRANSLATE_NOOP("FullscreenUI", "Automatic based on window size");
 TRANSLATE_NOOP("FullscreenUI", "Automatic mapping completed for {}.");
@@ -7266,6 +7288,7 @@ TRANSLATE_NOOP("FullscreenUI", "BIOS to use when emulating {} consoles.");
 TRANSLATE_NOOP("FullscreenUI", "Back");
 TRANSLATE_NOOP("FullscreenUI", "Back To Pause Menu");
 TRANSLATE_NOOP("FullscreenUI", "Backend Settings");
+TRANSLATE_NOOP("FullscreenUI", "Batches and submits draws for the hardware renderers on a second thread. Not available with OpenGL.");
 TRANSLATE_NOOP("FullscreenUI", "Behavior");
 TRANSLATE_NOOP("FullscreenUI", "Borderless Fullscreen");
 TRANSLATE_NOOP("FullscreenUI", "Buffer Size");
@@ -7381,6 +7404,7 @@ TRANSLATE_NOOP("FullscreenUI", "Enable Achievements");
 TRANSLATE_NOOP("FullscreenUI", "Enable Cheats");
 TRANSLATE_NOOP("FullscreenUI", "Enable Discord Presence");
 TRANSLATE_NOOP("FullscreenUI", "Enable Fast Boot");
+TRANSLATE_NOOP("FullscreenUI", "Enable Idle Loop Skipping");
 TRANSLATE_NOOP("FullscreenUI", "Enable In-Game Overlays");
 TRANSLATE_NOOP("FullscreenUI", "Enable Overclocking");
 TRANSLATE_NOOP("FullscreenUI", "Enable Post Processing");
@@ -7425,6 +7449,7 @@ TRANSLATE_NOOP("FullscreenUI", "Failed to save input profile '{}'.");
 TRANSLATE_NOOP("FullscreenUI", "Fast Boot");
 TRANSLATE_NOOP("FullscreenUI", "Fast Forward Speed");
 TRANSLATE_NOOP("FullscreenUI", "Fast Forward Volume");
+TRANSLATE_NOOP("FullscreenUI", "Fast-forwards to the next event when the game is waiting in a busy loop.");
 TRANSLATE_NOOP("FullscreenUI", "File Size");
 TRANSLATE_NOOP("FullscreenUI", "File Size: %.2f MB");
 TRANSLATE_NOOP("FullscreenUI", "File Title");
@@ -7723,6 +7748,7 @@ TRANSLATE_NOOP("FullscreenUI", "Simulates the CPU's instruction cache in the rec
 TRANSLATE_NOOP("FullscreenUI", "Simulates the region check present in original, unmodified consoles.");
 TRANSLATE_NOOP("FullscreenUI", "Simulates the system ahead of time and rolls back/replays to reduce input lag. Very high system requirements.");
 TRANSLATE_NOOP("FullscreenUI", "Skip Duplicate Frame Display");
+TRANSLATE_NOOP("FullscreenUI", "Skips rendering of frames when emulation falls behind the target speed.");
 TRANSLATE_NOOP("FullscreenUI", "Skips the presentation/display of frames that are not unique. Can result in worse frame pacing.");
 TRANSLATE_NOOP("FullscreenUI", "Slow Boot");
 TRANSLATE_NOOP("FullscreenUI", "Smooth Scrolling");
@@ -7765,6 +7791,7 @@ TRANSLATE_NOOP("FullscreenUI", "The audio backend determines how frames produced
 TRANSLATE_NOOP("FullscreenUI", "The selected memory card image will be used in shared mode for this slot.");
 TRANSLATE_NOOP("FullscreenUI", "This game has no achievements.");
 TRANSLATE_NOOP("FullscreenUI", "This game has no leaderboards.");
+TRANSLATE_NOOP("FullscreenUI", "Threaded Hardware Rendering");
 TRANSLATE_NOOP("FullscreenUI", "Threaded Rendering");
 TRANSLATE_NOOP("FullscreenUI", "Time Played");
 TRANSLATE_NOOP("FullscreenUI", "Time Played: %s");
@@ -7777,8 +7804,10 @@ TRANSLATE_NOOP("FullscreenUI", "Toggle every %d frames");
 TRANSLATE_NOOP("FullscreenUI", "True Color Debanding");
 TRANSLATE_NOOP("FullscreenUI", "True Color Rendering");
 TRANSLATE_NOOP("FullscreenUI", "Turbo Speed");
+TRANSLATE_NOOP("FullscreenUI", "Turbo runs as fast as possible, with no audio and the display only updated once per second.");
 TRANSLATE_NOOP("FullscreenUI", "Type");
 TRANSLATE_NOOP("FullscreenUI", "UI Language");
+TRANSLATE_NOOP("FullscreenUI", "Uncapped Turbo");
 TRANSLATE_NOOP("FullscreenUI", "Uncompressed Size");
 TRANSLATE_NOOP("FullscreenUI", "Uncompressed Size: %.2f MB");
 TRANSLATE_NOOP("FullscreenUI", "Undo Load State");
@@ -3,6 +3,7 @@
 
 #include "game_list.h"
 #include "bios.h"
+#include "fingerprint_cache.h"
 #include "fullscreen_ui.h"
 #include "host.h"
 #include "memory_card_image.h"
@@ -26,10 +27,13 @@
 #include "common/timer.h"
 
 #include "fmt/format.h"
+#include "xxhash.h"
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <ctime>
+#include <span>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
@@ -47,7 +51,10 @@ namespace {
 enum : u32
 {
   GAME_LIST_CACHE_SIGNATURE = 0x45434C48,
-  GAME_LIST_CACHE_VERSION = 35,
+  GAME_LIST_CACHE_VERSION = 36,
+
+  // Compact the cache when entries outside the sorted table exceed this percentage of the live entries.
+  GAME_LIST_CACHE_COMPACT_THRESHOLD = 25,
 
   PLAYED_TIME_SERIAL_LENGTH = 32,
   PLAYED_TIME_LAST_TIME_LENGTH = 20,  // uint64
@@ -62,6 +69,51 @@ struct PlayedTimeEntry
   std::time_t total_played_time;
 };
 
+// The cache file is a sorted table of fixed-size records followed by a string pool, which is mapped into memory and
+// searched in place. Entries scanned since the last compaction are appended after the pool in the variable-length
+// format written by WriteEntryToCache().
+struct CacheString
+{
+  u32 offset;
+  u32 length;
+};
+
+struct CacheHeader
+{
+  u32 signature;
+  u32 version;
+  u32 record_count;
+  u32 string_pool_size;
+};
+
+struct CacheRecord
+{
+  u64 path_hash;
+  CacheString path;
+  CacheString serial;
+  CacheString title;
+  CacheString disc_set_name;
+  CacheString genre;
+  CacheString publisher;
+  CacheString developer;
+  u64 hash;
+  s64 file_size;
+  u64 uncompressed_size;
+  u64 last_modified_time;
+  u64 release_date;
+  u16 supported_controllers;
+  u8 type;
+  u8 region;
+  u8 min_players;
+  u8 max_players;
+  u8 min_blocks;
+  u8 max_blocks;
+  s8 disc_set_index;
+  u8 compatibility;
+  u8 pad[6];
+};
+static_assert(sizeof(CacheHeader) == 16 && sizeof(CacheRecord) == 120);
+
 #pragma pack(push, 1)
 struct MemcardTimestampCacheEntry
 {
@@ -90,7 +142,7 @@ static bool GetDiscListEntry(const std::string& path, Entry* entry);
 static void ApplyCustomAttributes(const std::string& path, Entry* entry,
                                   const INISettingsInterface& custom_attributes_ini);
 static bool RescanCustomAttributesForPath(const std::string& path, const INISettingsInterface& custom_attributes_ini);
-static bool GetGameListEntryFromCache(const std::string& path, Entry* entry,
+static bool GetGameListEntryFromCache(const std::string& path, std::time_t timestamp, Entry* entry,
                                       const INISettingsInterface& custom_attributes_ini);
 static Entry* GetMutableEntryForPath(std::string_view path);
 static void ScanDirectory(const char* path, bool recursive, bool only_cache,
@@ -104,8 +156,15 @@ static bool ScanFile(std::string path, std::time_t timestamp, std::unique_lock<s
                      BinaryFileWriter& cache_writer);
 
 static bool LoadOrInitializeCache(std::FILE* fp, bool invalidate_cache);
-static bool LoadEntriesFromCache(BinaryFileReader& reader);
+static bool LoadEntriesFromCache(std::FILE* fp);
 static bool WriteEntryToCache(const Entry* entry, BinaryFileWriter& writer);
+static u64 GetCachePathHash(std::string_view path);
+static std::string_view GetCacheString(const CacheString& str);
+static const CacheRecord* FindCacheRecord(std::string_view path);
+static void PopulateEntryFromCacheRecord(const CacheRecord& record, Entry* entry);
+static void UnmapCache();
+static bool ShouldCompactCache();
+static bool CompactCache(std::FILE* fp);
 static void CreateDiscSetEntries(const std::vector<std::string>& excluded_paths, const PlayedTimeMap& played_time_map);
 
 static std::string GetPlayedTimeFile();
@@ -123,6 +182,13 @@ static bool UpdateMemcardTimestampCache(const MemcardTimestampCacheEntry& entry)
 static EntryList s_entries;
 static std::recursive_mutex s_mutex;
 static CacheMap s_cache_map;
+static std::vector<Entry> s_cache_appended_entries;
+static const void* s_cache_mapping = nullptr;
+static size_t s_cache_mapping_size = 0;
+static std::span<const CacheRecord> s_cache_records;
+static std::string_view s_cache_string_pool;
+static std::vector<bool> s_cache_records_used;
+static u32 s_cache_appended_count = 0;
 static std::vector<MemcardTimestampCacheEntry> s_memcard_timestamp_cache_entries;
 
 static bool s_game_list_loaded = false;
@@ -344,29 +410,151 @@ bool GameList::PopulateEntryFromPath(const std::string& path, Entry* entry)
   return GetDiscListEntry(path, entry);
 }
 
-bool GameList::GetGameListEntryFromCache(const std::string& path, Entry* entry,
+bool GameList::GetGameListEntryFromCache(const std::string& path, std::time_t timestamp, Entry* entry,
                                          const INISettingsInterface& custom_attributes_ini)
 {
+  // Appended entries are newer than the sorted table.
   auto iter = s_cache_map.find(path);
-  if (iter == s_cache_map.end())
-    return false;
+  if (iter != s_cache_map.end())
+  {
+    if (iter->second.last_modified_time != timestamp)
+      return false;
+
+    s_cache_appended_entries.push_back(iter->second);
+    *entry = std::move(iter->second);
+    s_cache_map.erase(iter);
+  }
+  else
+  {
+    const CacheRecord* record = FindCacheRecord(path);
+    if (!record || static_cast<std::time_t>(record->last_modified_time) != timestamp)
+      return false;
+
+    s_cache_records_used[record - s_cache_records.data()] = true;
+    PopulateEntryFromCacheRecord(*record, entry);
+    entry->path = path;
+  }
 
-  *entry = std::move(iter->second);
-  s_cache_map.erase(iter);
   ApplyCustomAttributes(path, entry, custom_attributes_ini);
   return true;
 }
 
-bool GameList::LoadEntriesFromCache(BinaryFileReader& reader)
+u64 GameList::GetCachePathHash(std::string_view path)
+{
+  return XXH3_64bits(path.data(), path.size());
+}
+
+std::string_view GameList::GetCacheString(const CacheString& str)
 {
-  u32 file_signature, file_version;
-  if (!reader.ReadU32(&file_signature) || !reader.ReadU32(&file_version) ||
-      file_signature != GAME_LIST_CACHE_SIGNATURE || file_version != GAME_LIST_CACHE_VERSION)
+  return s_cache_string_pool.substr(str.offset, str.length);
+}
+
+const GameList::CacheRecord* GameList::FindCacheRecord(std::string_view path)
+{
+  const u64 path_hash = GetCachePathHash(path);
+  auto iter = std::lower_bound(s_cache_records.begin(), s_cache_records.end(), path_hash,
+                               [](const CacheRecord& rec, u64 hash) { return (rec.path_hash < hash); });
+  for (; iter != s_cache_records.end() && iter->path_hash == path_hash; ++iter)
+  {
+    if (GetCacheString(iter->path) == path)
+      return &(*iter);
+  }
+
+  return nullptr;
+}
+
+void GameList::PopulateEntryFromCacheRecord(const CacheRecord& record, Entry* entry)
+{
+  entry->type = static_cast<EntryType>(record.type);
+  entry->region = static_cast<DiscRegion>(record.region);
+  entry->serial = GetCacheString(record.serial);
+  entry->title = GetCacheString(record.title);
+  entry->disc_set_name = GetCacheString(record.disc_set_name);
+  entry->genre = GetCacheString(record.genre);
+  entry->publisher = GetCacheString(record.publisher);
+  entry->developer = GetCacheString(record.developer);
+  entry->hash = record.hash;
+  entry->file_size = record.file_size;
+  entry->uncompressed_size = record.uncompressed_size;
+  entry->last_modified_time = static_cast<std::time_t>(record.last_modified_time);
+  entry->release_date = record.release_date;
+  entry->supported_controllers = record.supported_controllers;
+  entry->min_players = record.min_players;
+  entry->max_players = record.max_players;
+  entry->min_blocks = record.min_blocks;
+  entry->max_blocks = record.max_blocks;
+  entry->disc_set_index = record.disc_set_index;
+  entry->compatibility = static_cast<GameDatabase::CompatibilityRating>(record.compatibility);
+}
+
+bool GameList::LoadEntriesFromCache(std::FILE* fp)
+{
+  BinaryFileReader reader(fp);
+  CacheHeader header;
+  if (!reader.ReadT(&header) || header.signature != GAME_LIST_CACHE_SIGNATURE ||
+      header.version != GAME_LIST_CACHE_VERSION)
   {
     WARNING_LOG("Game list cache is corrupted");
     return false;
   }
 
+  const s64 file_size = FileSystem::FSize64(fp);
+  const u64 table_size = sizeof(CacheHeader) + static_cast<u64>(header.record_count) * sizeof(CacheRecord) +
+                         static_cast<u64>(header.string_pool_size);
+  if (file_size < 0 || static_cast<u64>(file_size) < table_size)
+  {
+    WARNING_LOG("Game list cache is truncated");
+    return false;
+  }
+
+  if (header.record_count > 0)
+  {
+    Error error;
+    s_cache_mapping_size = static_cast<size_t>(table_size);
+    s_cache_mapping = FileSystem::MapFileReadOnly(fp, s_cache_mapping_size, &error);
+    if (!s_cache_mapping)
+    {
+      ERROR_LOG("Failed to map game list cache: {}", error.GetDescription());
+      return false;
+    }
+
+    const u8* base = static_cast<const u8*>(s_cache_mapping);
+    s_cache_records = std::span<const CacheRecord>(reinterpret_cast<const CacheRecord*>(base + sizeof(CacheHeader)),
+                                                   header.record_count);
+    s_cache_string_pool = std::string_view(reinterpret_cast<const char*>(s_cache_records.data() + header.record_count),
+                                           header.string_pool_size);
+    s_cache_records_used.resize(header.record_count);
+
+    // Validate up front so lookups don't need to. This only touches the records, not the strings.
+    u64 last_hash = 0;
+    for (const CacheRecord& record : s_cache_records)
+    {
+      for (const CacheString* str : {&record.path, &record.serial, &record.title, &record.disc_set_name, &record.genre,
+                                     &record.publisher, &record.developer})
+      {
+        if ((static_cast<u64>(str->offset) + str->length) > header.string_pool_size)
+        {
+          WARNING_LOG("Game list cache string is out of range");
+          return false;
+        }
+      }
+
+      if (record.path_hash < last_hash || record.region >= static_cast<u8>(DiscRegion::Count) ||
+          record.type >= static_cast<u8>(EntryType::Count) ||
+          record.compatibility >= static_cast<u8>(GameDatabase::CompatibilityRating::Count))
+      {
+        WARNING_LOG("Game list cache record is corrupted");
+        return false;
+      }
+
+      last_hash = record.path_hash;
+    }
+  }
+
+  // Entries appended since the last compaction.
+  if (!FileSystem::FSeek64(fp, static_cast<s64>(table_size), SEEK_SET, nullptr))
+    return false;
+
   while (!reader.IsAtEnd())
   {
     std::string path;
@@ -396,6 +584,7 @@ bool GameList::LoadEntriesFromCache(BinaryFileReader& reader)
     ge.region = static_cast<DiscRegion>(region);
     ge.type = static_cast<EntryType>(type);
     ge.compatibility = static_cast<GameDatabase::CompatibilityRating>(compatibility_rating);
+    s_cache_appended_count++;
 
     auto iter = s_cache_map.find(ge.path);
     if (iter != s_cache_map.end())
@@ -433,17 +622,133 @@ bool GameList::WriteEntryToCache(const Entry* entry, BinaryFileWriter& writer)
   return writer.IsGood();
 }
 
+void GameList::UnmapCache()
+{
+  if (s_cache_mapping)
+  {
+    FileSystem::UnmapFile(s_cache_mapping, s_cache_mapping_size);
+    s_cache_mapping = nullptr;
+    s_cache_mapping_size = 0;
+  }
+
+  s_cache_records = {};
+  s_cache_string_pool = {};
+  s_cache_records_used = {};
+  s_cache_appended_count = 0;
+  s_cache_map.clear();
+  s_cache_appended_entries = {};
+}
+
+bool GameList::ShouldCompactCache()
+{
+  const u32 used_records =
+    static_cast<u32>(std::count(s_cache_records_used.begin(), s_cache_records_used.end(), true));
+  const u32 stale_records = static_cast<u32>(s_cache_records.size()) - used_records;
+  const u32 live_entries = used_records + static_cast<u32>(s_cache_appended_entries.size());
+  const u32 unsorted_entries = stale_records + s_cache_appended_count;
+  return (unsorted_entries > 0 && (static_cast<u64>(unsorted_entries) * 100) >=
+                                    (static_cast<u64>(live_entries) * GAME_LIST_CACHE_COMPACT_THRESHOLD));
+}
+
+bool GameList::CompactCache(std::FILE* fp)
+{
+  std::vector<CacheRecord> records;
+  std::string string_pool;
+  records.reserve(s_cache_records.size() + s_cache_appended_entries.size());
+
+  const auto add_string = [&string_pool](std::string_view str) {
+    const CacheString ret = {static_cast<u32>(string_pool.size()), static_cast<u32>(str.size())};
+    string_pool.append(str);
+    return ret;
+  };
+
+  for (size_t i = 0; i < s_cache_records.size(); i++)
+  {
+    if (!s_cache_records_used[i])
+      continue;
+
+    const CacheRecord& old_record = s_cache_records[i];
+    CacheRecord& record = records.emplace_back(old_record);
+    record.path = add_string(GetCacheString(old_record.path));
+    record.serial = add_string(GetCacheString(old_record.serial));
+    record.title = add_string(GetCacheString(old_record.title));
+    record.disc_set_name = add_string(GetCacheString(old_record.disc_set_name));
+    record.genre = add_string(GetCacheString(old_record.genre));
+    record.publisher = add_string(GetCacheString(old_record.publisher));
+    record.developer = add_string(GetCacheString(old_record.developer));
+  }
+
+  for (const Entry& entry : s_cache_appended_entries)
+  {
+    CacheRecord& record = records.emplace_back();
+    std::memset(&record, 0, sizeof(record));
+    record.path_hash = GetCachePathHash(entry.path);
+    record.path = add_string(entry.path);
+    record.serial = add_string(entry.serial);
+    record.title = add_string(entry.title);
+    record.disc_set_name = add_string(entry.disc_set_name);
+    record.genre = add_string(entry.genre);
+    record.publisher = add_string(entry.publisher);
+    record.developer = add_string(entry.developer);
+    record.hash = entry.hash;
+    record.file_size = entry.file_size;
+    record.uncompressed_size = entry.uncompressed_size;
+    record.last_modified_time = static_cast<u64>(entry.last_modified_time);
+    record.release_date = entry.release_date;
+    record.supported_controllers = entry.supported_controllers;
+    record.type = static_cast<u8>(entry.type);
+    record.region = static_cast<u8>(entry.region);
+    record.min_players = entry.min_players;
+    record.max_players = entry.max_players;
+    record.min_blocks = entry.min_blocks;
+    record.max_blocks = entry.max_blocks;
+    record.disc_set_index = entry.disc_set_index;
+    record.compatibility = static_cast<u8>(entry.compatibility);
+  }
+
+  std::sort(records.begin(), records.end(),
+            [](const CacheRecord& lhs, const CacheRecord& rhs) { return (lhs.path_hash < rhs.path_hash); });
+
+  INFO_LOG("Compacting game list cache from {} to {} records.",
+           s_cache_records.size() + s_cache_appended_count, records.size());
+
+  // Can't truncate the file while it's mapped.
+  UnmapCache();
+
+  Error error;
+  if (!FileSystem::FSeek64(fp, 0, SEEK_SET, &error) || !FileSystem::FTruncate64(fp, 0, &error))
+  {
+    ERROR_LOG("Failed to truncate game list cache: {}", error.GetDescription());
+    return false;
+  }
+
+  const CacheHeader header = {GAME_LIST_CACHE_SIGNATURE, GAME_LIST_CACHE_VERSION, static_cast<u32>(records.size()),
+                              static_cast<u32>(string_pool.size())};
+  BinaryFileWriter writer(fp);
+  writer.WriteT(header);
+  writer.Write(records.data(), records.size() * sizeof(CacheRecord));
+  writer.Write(string_pool.data(), string_pool.size());
+  if (!writer.Flush(&error))
+  {
+    ERROR_LOG("Failed to write game list cache: {}", error.GetDescription());
+    return false;
+  }
+
+  return true;
+}
+
 bool GameList::LoadOrInitializeCache(std::FILE* fp, bool invalidate_cache)
 {
-  BinaryFileReader reader(fp);
-  if (!invalidate_cache && !reader.IsAtEnd() && LoadEntriesFromCache(reader))
+  UnmapCache();
+
+  if (!invalidate_cache && FileSystem::FSize64(fp) > 0 && LoadEntriesFromCache(fp))
   {
     // Prepare for writing.
     return (FileSystem::FSeek64(fp, 0, SEEK_END) == 0);
   }
 
   WARNING_LOG("Initializing game list cache.");
-  s_cache_map.clear();
+  UnmapCache();
 
   // Truncate file, and re-write header.
   Error error;
@@ -453,9 +758,9 @@ bool GameList::LoadOrInitializeCache(std::FILE* fp, bool invalidate_cache)
     return false;
   }
 
+  const CacheHeader header = {GAME_LIST_CACHE_SIGNATURE, GAME_LIST_CACHE_VERSION, 0, 0};
   BinaryFileWriter writer(fp);
-  writer.WriteU32(GAME_LIST_CACHE_SIGNATURE);
-  writer.WriteU32((GAME_LIST_CACHE_VERSION));
+  writer.WriteT(header);
   if (!writer.Flush(&error))
   {
     ERROR_LOG("Failed to write game list cache header: {}", error.GetDescription());
@@ -480,11 +785,19 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 
   progress->SetStatusText(SmallString::from_format(TRANSLATE_FS("GameList", "Scanning directory '{}'..."), path));
 
+  // Filter while enumerating, so we don't hold on to every file in the tree.
   FileSystem::FindResultsArray files;
   FileSystem::FindFiles(path, "*",
-                        recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE) :
+                        recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE |
+                                     FILESYSTEM_FIND_PARALLEL) :
                                     (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES),
-                        &files);
+                        [&files, &excluded_paths](FILESYSTEM_FIND_DATA&& ffd) {
+                          if (GameList::IsScannableFilename(ffd.FileName) &&
+                              !IsPathExcluded(excluded_paths, ffd.FileName))
+                          {
+                            files.push_back(std::move(ffd));
+                          }
+                        });
   if (files.empty())
     return;
 
@@ -497,11 +810,8 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
   {
     files_scanned++;
 
-    if (progress->IsCancelled() || !GameList::IsScannableFilename(ffd.FileName) ||
-        IsPathExcluded(excluded_paths, ffd.FileName))
-    {
+    if (progress->IsCancelled())
       continue;
-    }
 
     std::unique_lock lock(s_mutex);
     if (GetEntryForPath(ffd.FileName) ||
@@ -524,7 +834,7 @@ bool GameList::AddFileFromCache(const std::string& path, std::time_t timestamp,
                                 const INISettingsInterface& custom_attributes_ini)
 {
   Entry entry;
-  if (!GetGameListEntryFromCache(path, &entry, custom_attributes_ini) || entry.last_modified_time != timestamp)
+  if (!GetGameListEntryFromCache(path, timestamp, &entry, custom_attributes_ini))
     return false;
 
   auto iter = played_time_map.find(entry.serial);
@@ -554,8 +864,15 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
   entry.path = std::move(path);
   entry.last_modified_time = timestamp;
 
-  if (cache_writer.IsOpen() && !WriteEntryToCache(&entry, cache_writer)) [[unlikely]]
-    WARNING_LOG("Failed to write entry '{}' to cache", entry.path);
+  if (cache_writer.IsOpen())
+  {
+    if (!WriteEntryToCache(&entry, cache_writer)) [[unlikely]]
+      WARNING_LOG("Failed to write entry '{}' to cache", entry.path);
+
+    // Keep a copy without custom attributes for compaction.
+    s_cache_appended_entries.push_back(entry);
+    s_cache_appended_count++;
+  }
 
   const auto iter = played_time_map.find(entry.serial);
   if (iter != played_time_map.end())
@@ -759,6 +1076,10 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
   if (!progress)
     progress = ProgressCallback::NullProgressCallback;
 
+  // Rescanning everything should also rehash everything.
+  if (invalidate_cache)
+    FingerprintCache::Clear();
+
   Error error;
   FileSystem::ManagedCFilePtr cache_file =
     FileSystem::OpenExistingOrCreateManagedCFile(Path::Combine(EmuFolders::Cache, "gamelist.cache").c_str(), 0, &error);
@@ -801,6 +1122,9 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
 
   if (!dirs.empty() || !recursive_dirs.empty())
   {
+    // Newly-scanned files are fingerprinted, write them to the cache in one go.
+    FingerprintCache::BeginBatch();
+
     progress->SetProgressRange(static_cast<u32>(dirs.size() + recursive_dirs.size()));
     progress->SetProgressValue(0);
 
@@ -824,10 +1148,17 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
                     progress);
       progress->SetProgressValue(++directory_counter);
     }
+
+    FingerprintCache::EndBatch();
   }
 
+  // Rewrite the cache if it's accumulated too many stale or unsorted entries. Skip this if we were cancelled,
+  // since we won't have seen every entry.
+  if (cache_file && !progress->IsCancelled() && ShouldCompactCache())
+    CompactCache(cache_file.get());
+
   // don't need unused cache entries
-  s_cache_map.clear();
+  UnmapCache();
 
   // merge multi-disc games
   CreateDiscSetEntries(excluded_paths, played_time);
@@ -61,6 +61,9 @@ static u32 s_active_gpu_cycles_frames = 0;
 
 static constexpr GPUTexture::Format DISPLAY_INTERNAL_POSTFX_FORMAT = GPUTexture::Format::RGBA8;
 
+/// Extra lines a deinterlace texture can have before it is recreated. Covers the field height toggling by a line.
+static constexpr u32 DEINTERLACE_HEIGHT_SLACK = 2;
+
 static bool CompressAndWriteTextureToFile(u32 width, u32 height, std::string filename, FileSystem::ManagedCFilePtr fp,
                                           u8 quality, bool clear_alpha, bool flip_y, std::vector<u32> texture_data,
                                           u32 texture_data_stride, GPUTexture::Format texture_format,
@@ -385,6 +388,11 @@ void GPU::RestoreDeviceContext()
 {
 }
 
+void GPU::SyncRenderer()
+{
+  FlushRender();
+}
+
 void GPU::UpdateDMARequest()
 {
   switch (m_blitter_state)
@@ -924,13 +932,27 @@ void GPU::UpdateCRTCTickEvent()
   }
 
   s_crtc_tick_event.Schedule(CRTCTicksToSystemTicks(ticks_until_event, m_crtc_state.fractional_ticks));
+
+  // GPUSTAT and timer reads poll for the next line, precompute it so they don't need to convert each time.
+  // This is the exact inverse of SystemTicksToCRTCTicks(), rounding up.
+  const u64 divider = !m_console_is_pal ? u64(715909) : u64(709379);
+  const u64 crtc_ticks_until_next_scanline =
+    u64(m_crtc_state.horizontal_total - m_crtc_state.current_tick_in_scanline) * u64(451584) -
+    u64(m_crtc_state.fractional_ticks);
+  m_crtc_state.sysclk_ticks_until_next_scanline =
+    static_cast<TickCount>((crtc_ticks_until_next_scanline + (divider - 1)) / divider);
 }
 
 bool GPU::IsCRTCScanlinePending() const
 {
   // TODO: Most of these should be fields, not lines.
-  const TickCount ticks = (GetPendingCRTCTicks() + m_crtc_state.current_tick_in_scanline);
-  return (ticks >= m_crtc_state.horizontal_total);
+  return (s_crtc_tick_event.GetTicksSinceLastExecution() >= m_crtc_state.sysclk_ticks_until_next_scanline);
+}
+
+TickCount GPU::GetSystemTicksUntilNextScanline() const
+{
+  return std::max<TickCount>(
+    m_crtc_state.sysclk_ticks_until_next_scanline - s_crtc_tick_event.GetTicksSinceLastExecution(), 0);
 }
 
 bool GPU::IsCommandCompletionPending() const
@@ -1910,6 +1932,7 @@ bool GPU::CompileDisplayPipelines(bool display, bool deinterlace, bool chroma_sm
         GL_OBJECT_NAME(fso, "Blend Deinterlace Fragment Shader");
 
         plconfig.layout = GPUPipeline::Layout::MultiTextureAndPushConstants;
+        plconfig.color_formats[1] = GPUTexture::Format::RGBA8;
         plconfig.vertex_shader = vso.get();
         plconfig.fragment_shader = fso.get();
         if (!(m_deinterlace_pipeline = g_gpu_device->CreatePipeline(plconfig)))
@@ -1929,6 +1952,7 @@ bool GPU::CompileDisplayPipelines(bool display, bool deinterlace, bool chroma_sm
         GL_OBJECT_NAME(fso, "FastMAD Reconstruct Fragment Shader");
 
         plconfig.layout = GPUPipeline::Layout::MultiTextureAndPushConstants;
+        plconfig.color_formats[1] = GPUTexture::Format::RGBA8;
         plconfig.fragment_shader = fso.get();
         if (!(m_deinterlace_pipeline = g_gpu_device->CreatePipeline(plconfig)))
           return false;
@@ -2273,25 +2297,32 @@ bool GPU::Deinterlace(u32 field, u32 line_skip)
       const u32 this_buffer = m_current_deinterlace_buffer;
       m_current_deinterlace_buffer = (m_current_deinterlace_buffer + 1u) % NUM_BLEND_BUFFERS;
       GL_INS_FMT("Current buffer: {}", this_buffer);
-      if (!DeinterlaceExtractField(this_buffer, src, x, y, width, height, line_skip) ||
-          !DeinterlaceSetTargetSize(width, height, false)) [[unlikely]]
+      if (!DeinterlaceSetTargetSize(width, height, false) ||
+          !DeinterlaceSetBufferSize(this_buffer, m_deinterlace_texture->GetWidth(),
+                                    m_deinterlace_texture->GetHeight())) [[unlikely]]
       {
         ClearDisplayTexture();
         return false;
       }
 
-      // TODO: could be implemented with alpha blending instead..
+      // The field is read directly from the source, and stored to the history buffer in the same pass.
+      src->MakeReadyForSampling();
 
-      g_gpu_device->InvalidateRenderTarget(m_deinterlace_texture.get());
-      g_gpu_device->SetRenderTarget(m_deinterlace_texture.get());
+      GPUTexture* const rts[] = {m_deinterlace_texture.get(), m_deinterlace_buffers[this_buffer].get()};
+      g_gpu_device->InvalidateRenderTarget(rts[0]);
+      g_gpu_device->InvalidateRenderTarget(rts[1]);
+      g_gpu_device->SetRenderTargets(rts, static_cast<u32>(std::size(rts)), nullptr);
       g_gpu_device->SetPipeline(m_deinterlace_pipeline.get());
-      g_gpu_device->SetTextureSampler(0, m_deinterlace_buffers[this_buffer].get(), g_gpu_device->GetNearestSampler());
+      g_gpu_device->SetTextureSampler(0, src, g_gpu_device->GetNearestSampler());
       g_gpu_device->SetTextureSampler(1, m_deinterlace_buffers[(this_buffer - 1) % NUM_BLEND_BUFFERS].get(),
                                       g_gpu_device->GetNearestSampler());
+      const u32 uniforms[] = {x, y, line_skip};
+      g_gpu_device->PushUniformBuffer(uniforms, sizeof(uniforms));
       g_gpu_device->SetViewportAndScissor(0, 0, width, height);
       g_gpu_device->Draw(3, 0);
 
       m_deinterlace_texture->MakeReadyForSampling();
+      m_deinterlace_buffers[this_buffer]->MakeReadyForSampling();
       SetDisplayTexture(m_deinterlace_texture.get(), m_display_depth_buffer, 0, 0, width, height);
       return true;
     }
@@ -2305,28 +2336,36 @@ bool GPU::Deinterlace(u32 field, u32 line_skip)
       const u32 this_buffer = m_current_deinterlace_buffer;
       m_current_deinterlace_buffer = (m_current_deinterlace_buffer + 1u) % DEINTERLACE_BUFFER_COUNT;
       GL_INS_FMT("Current buffer: {}", this_buffer);
-      if (!DeinterlaceExtractField(this_buffer, src, x, y, width, height, line_skip) ||
-          !DeinterlaceSetTargetSize(width, full_height, false)) [[unlikely]]
+      if (!DeinterlaceSetTargetSize(width, full_height, false) ||
+          !DeinterlaceSetBufferSize(this_buffer, m_deinterlace_texture->GetWidth(),
+                                    m_deinterlace_texture->GetHeight())) [[unlikely]]
       {
         ClearDisplayTexture();
         return false;
       }
 
-      g_gpu_device->SetRenderTarget(m_deinterlace_texture.get());
+      // History buffers are full height, so the current field can be stored as a second output of this pass.
+      src->MakeReadyForSampling();
+
+      GPUTexture* const rts[] = {m_deinterlace_texture.get(), m_deinterlace_buffers[this_buffer].get()};
+      g_gpu_device->InvalidateRenderTarget(rts[0]);
+      g_gpu_device->InvalidateRenderTarget(rts[1]);
+      g_gpu_device->SetRenderTargets(rts, static_cast<u32>(std::size(rts)), nullptr);
       g_gpu_device->SetPipeline(m_deinterlace_pipeline.get());
-      g_gpu_device->SetTextureSampler(0, m_deinterlace_buffers[this_buffer].get(), g_gpu_device->GetNearestSampler());
+      g_gpu_device->SetTextureSampler(0, src, g_gpu_device->GetNearestSampler());
       g_gpu_device->SetTextureSampler(1, m_deinterlace_buffers[(this_buffer - 1) % DEINTERLACE_BUFFER_COUNT].get(),
                                       g_gpu_device->GetNearestSampler());
       g_gpu_device->SetTextureSampler(2, m_deinterlace_buffers[(this_buffer - 2) % DEINTERLACE_BUFFER_COUNT].get(),
                                       g_gpu_device->GetNearestSampler());
       g_gpu_device->SetTextureSampler(3, m_deinterlace_buffers[(this_buffer - 3) % DEINTERLACE_BUFFER_COUNT].get(),
                                       g_gpu_device->GetNearestSampler());
-      const u32 uniforms[] = {field, full_height};
+      const u32 uniforms[] = {x, y, line_skip, field, full_height};
       g_gpu_device->PushUniformBuffer(uniforms, sizeof(uniforms));
       g_gpu_device->SetViewportAndScissor(0, 0, width, full_height);
       g_gpu_device->Draw(3, 0);
 
       m_deinterlace_texture->MakeReadyForSampling();
+      m_deinterlace_buffers[this_buffer]->MakeReadyForSampling();
       SetDisplayTexture(m_deinterlace_texture.get(), m_display_depth_buffer, 0, 0, width, full_height);
       return true;
     }
@@ -2338,16 +2377,10 @@ bool GPU::Deinterlace(u32 field, u32 line_skip)
 
 bool GPU::DeinterlaceExtractField(u32 dst_bufidx, GPUTexture* src, u32 x, u32 y, u32 width, u32 height, u32 line_skip)
 {
-  if (!m_deinterlace_buffers[dst_bufidx] || m_deinterlace_buffers[dst_bufidx]->GetWidth() != width ||
-      m_deinterlace_buffers[dst_bufidx]->GetHeight() != height)
+  if (!DeinterlaceTextureFits(m_deinterlace_buffers[dst_bufidx].get(), width, height) &&
+      !DeinterlaceSetBufferSize(dst_bufidx, width, height)) [[unlikely]]
   {
-    if (!g_gpu_device->ResizeTexture(&m_deinterlace_buffers[dst_bufidx], width, height, GPUTexture::Type::RenderTarget,
-                                     GPUTexture::Format::RGBA8, false)) [[unlikely]]
-    {
-      return false;
-    }
-
-    GL_OBJECT_NAME_FMT(m_deinterlace_buffers[dst_bufidx], "Blend Deinterlace Buffer {}", dst_bufidx);
+    return false;
   }
 
   GPUTexture* dst = m_deinterlace_buffers[dst_bufidx].get();
@@ -2381,10 +2414,34 @@ bool GPU::DeinterlaceExtractField(u32 dst_bufidx, GPUTexture* src, u32 x, u32 y,
   return true;
 }
 
+bool GPU::DeinterlaceSetBufferSize(u32 bufidx, u32 width, u32 height)
+{
+  // Must match the target size exactly, since the history buffers are also written as a second render target.
+  if (!m_deinterlace_buffers[bufidx] || m_deinterlace_buffers[bufidx]->GetWidth() != width ||
+      m_deinterlace_buffers[bufidx]->GetHeight() != height)
+  {
+    if (!g_gpu_device->ResizeTexture(&m_deinterlace_buffers[bufidx], width, height, GPUTexture::Type::RenderTarget,
+                                     GPUTexture::Format::RGBA8, false)) [[unlikely]]
+    {
+      return false;
+    }
+
+    GL_OBJECT_NAME_FMT(m_deinterlace_buffers[bufidx], "Deinterlace Buffer {}", bufidx);
+  }
+
+  return true;
+}
+
+bool GPU::DeinterlaceTextureFits(const GPUTexture* tex, u32 width, u32 height)
+{
+  return (tex && tex->GetWidth() == width && tex->GetHeight() >= height &&
+          (tex->GetHeight() - height) <= DEINTERLACE_HEIGHT_SLACK);
+}
+
 bool GPU::DeinterlaceSetTargetSize(u32 width, u32 height, bool preserve)
 {
-  if (!m_deinterlace_texture || m_deinterlace_texture->GetWidth() != width ||
-      m_deinterlace_texture->GetHeight() != height)
+  // Keep the existing target if it is only slightly taller, the view rectangle covers the difference.
+  if (!DeinterlaceTextureFits(m_deinterlace_texture.get(), width, height))
   {
     if (!g_gpu_device->ResizeTexture(&m_deinterlace_texture, width, height, GPUTexture::Type::RenderTarget,
                                      GPUTexture::Format::RGBA8, preserve)) [[unlikely]]
@@ -149,6 +149,10 @@ public:
   /// Returns true if we're in PAL mode, otherwise false if NTSC.
   ALWAYS_INLINE bool IsInPALMode() const { return m_GPUSTAT.pal_mode; }
 
+  /// Drops drawing commands while enabled, for frame skipping. VRAM transfers and CLUT updates still execute.
+  ALWAYS_INLINE bool IsSkippingDrawCommands() const { return m_skip_draw_commands; }
+  ALWAYS_INLINE void SetSkipDrawCommands(bool enabled) { m_skip_draw_commands = enabled; }
+
   /// Returns the number of pending GPU ticks.
   TickCount GetPendingCRTCTicks() const;
   TickCount GetPendingCommandTicks() const;
@@ -156,6 +160,9 @@ public:
   /// Returns true if enough ticks have passed for the raster to be on the next line.
   bool IsCRTCScanlinePending() const;
 
+  /// Returns the number of system ticks until the raster reaches the next scanline.
+  TickCount GetSystemTicksUntilNextScanline() const;
+
   /// Returns true if a raster scanline or command execution is pending.
   bool IsCommandCompletionPending() const;
 
@@ -213,6 +220,9 @@ public:
   // Ensures all buffered vertices are drawn.
   virtual void FlushRender() = 0;
 
+  /// Flushes rendering, and waits for any thread using the GPU device to go idle. Call before using the device.
+  virtual void SyncRenderer();
+
   /// Helper function for computing the draw rectangle in a larger window.
   void CalculateDrawRect(s32 window_width, s32 window_height, bool apply_rotation, bool apply_aspect_ratio,
                          GSVector4i* display_rect, GSVector4i* draw_rect) const;
@@ -413,6 +423,12 @@ protected:
     AddCommandTicks(std::max(drawn_width, drawn_height));
   }
 
+  /// Adds the draw time for a polygon's triangles, skipping those which would be culled.
+  void AddDrawPolygonTicks(GPURenderCommand rc, const GSVector2i* positions);
+
+  /// Consumes the vertices of a render command which is not drawn, still adding the time it would take to draw.
+  void SkipRenderCommand();
+
   union GPUSTAT
   {
     u32 bits;
@@ -506,6 +522,7 @@ protected:
   bool m_set_texture_disable_mask = false;
   bool m_drawing_area_changed = false;
   bool m_force_progressive_scan = false;
+  bool m_skip_draw_commands = false;
   ForceVideoTimingMode m_force_frame_timings = ForceVideoTimingMode::Disabled;
 
   struct CRTCState
@@ -576,6 +593,9 @@ protected:
 
     TickCount fractional_dot_ticks; // only used when timer0 is enabled
 
+    // System ticks from the last CRTC event until the beam reaches the next line. Not saved, derived from the above.
+    TickCount sysclk_ticks_until_next_scanline;
+
     bool in_hblank;
     bool in_vblank;
 
@@ -636,6 +656,8 @@ protected:
 
   bool Deinterlace(u32 field, u32 line_skip);
   bool DeinterlaceExtractField(u32 dst_bufidx, GPUTexture* src, u32 x, u32 y, u32 width, u32 height, u32 line_skip);
+  bool DeinterlaceSetBufferSize(u32 bufidx, u32 width, u32 height);
+  static bool DeinterlaceTextureFits(const GPUTexture* tex, u32 width, u32 height);
   bool DeinterlaceSetTargetSize(u32 width, u32 height, bool preserve);
   void DestroyDeinterlaceTextures();
   bool ApplyChromaSmoothing();
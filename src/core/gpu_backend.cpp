@@ -50,6 +50,12 @@ void GPUBackend::Shutdown()
   StopGPUThread();
 }
 
+GPUBackendCommand* GPUBackend::NewFlushRenderCommand()
+{
+  return static_cast<GPUBackendCommand*>(
+    AllocateCommand(GPUBackendCommandType::FlushRender, sizeof(GPUBackendCommand)));
+}
+
 GPUBackendFillVRAMCommand* GPUBackend::NewFillVRAMCommand()
 {
   return static_cast<GPUBackendFillVRAMCommand*>(
@@ -91,6 +97,16 @@ GPUBackendDrawPolygonCommand* GPUBackend::NewDrawPolygonCommand(u32 num_vertices
   return cmd;
 }
 
+GPUBackendDrawPrecisePolygonCommand* GPUBackend::NewDrawPrecisePolygonCommand(u32 num_vertices)
+{
+  const u32 size =
+    sizeof(GPUBackendDrawPrecisePolygonCommand) + (num_vertices * sizeof(GPUBackendDrawPrecisePolygonCommand::Vertex));
+  GPUBackendDrawPrecisePolygonCommand* cmd = static_cast<GPUBackendDrawPrecisePolygonCommand*>(
+    AllocateCommand(GPUBackendCommandType::DrawPrecisePolygon, size));
+  cmd->num_vertices = Truncate16(num_vertices);
+  return cmd;
+}
+
 GPUBackendDrawRectangleCommand* GPUBackend::NewDrawRectangleCommand()
 {
   return static_cast<GPUBackendDrawRectangleCommand*>(
@@ -279,10 +295,21 @@ void GPUBackend::RunGPULoop()
   }
 }
 
+void GPUBackend::DrawPrecisePolygon(const GPUBackendDrawPrecisePolygonCommand* cmd)
+{
+  Panic("Backend does not support precise polygons");
+}
+
 void GPUBackend::HandleCommand(const GPUBackendCommand* cmd)
 {
   switch (cmd->type)
   {
+    case GPUBackendCommandType::FlushRender:
+    {
+      FlushRender();
+    }
+    break;
+
     case GPUBackendCommandType::FillVRAM:
     {
       FlushRender();
@@ -331,6 +358,12 @@ void GPUBackend::HandleCommand(const GPUBackendCommand* cmd)
     }
     break;
 
+    case GPUBackendCommandType::DrawPrecisePolygon:
+    {
+      DrawPrecisePolygon(static_cast<const GPUBackendDrawPrecisePolygonCommand*>(cmd));
+    }
+    break;
+
     case GPUBackendCommandType::DrawRectangle:
     {
       DrawRectangle(static_cast<const GPUBackendDrawRectangleCommand*>(cmd));
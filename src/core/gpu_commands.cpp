@@ -92,7 +92,10 @@ void GPU::TryExecuteCommands()
           // drop terminator
           m_fifo.RemoveOne();
           DEBUG_LOG("Drawing poly-line with {} vertices", GetPolyLineVertexCount());
-          DispatchRenderCommand();
+          if (!m_skip_draw_commands) [[likely]]
+            DispatchRenderCommand();
+          else
+            SkipRenderCommand();
           m_blit_buffer.clear();
           EndCommand();
           continue;
@@ -359,7 +362,11 @@ bool GPU::HandleRenderPolygonCommand()
   m_render_command.bits = rc.bits;
   m_fifo.RemoveOne();
 
-  DispatchRenderCommand();
+  if (!m_skip_draw_commands) [[likely]]
+    DispatchRenderCommand();
+  else
+    SkipRenderCommand();
+
   EndCommand();
   return true;
 }
@@ -393,7 +400,11 @@ bool GPU::HandleRenderRectangleCommand()
   m_render_command.bits = rc.bits;
   m_fifo.RemoveOne();
 
-  DispatchRenderCommand();
+  if (!m_skip_draw_commands) [[likely]]
+    DispatchRenderCommand();
+  else
+    SkipRenderCommand();
+
   EndCommand();
   return true;
 }
@@ -415,7 +426,11 @@ bool GPU::HandleRenderLineCommand()
   m_render_command.bits = rc.bits;
   m_fifo.RemoveOne();
 
-  DispatchRenderCommand();
+  if (!m_skip_draw_commands) [[likely]]
+    DispatchRenderCommand();
+  else
+    SkipRenderCommand();
+
   EndCommand();
   return true;
 }
@@ -452,6 +467,132 @@ bool GPU::HandleRenderPolyLineCommand()
   return true;
 }
 
+void GPU::AddDrawPolygonTicks(GPURenderCommand rc, const GSVector2i* positions)
+{
+  const GSVector2i min_pos_12 = positions[1].min_i32(positions[2]);
+  const GSVector2i max_pos_12 = positions[1].max_i32(positions[2]);
+  const GSVector4i draw_rect_012 = GSVector4i(min_pos_12.min_i32(positions[0]))
+                                     .upl64(GSVector4i(max_pos_12.max_i32(positions[0])))
+                                     .add32(GSVector4i::cxpr(0, 0, 1, 1));
+  if (draw_rect_012.width() <= MAX_PRIMITIVE_WIDTH && draw_rect_012.height() <= MAX_PRIMITIVE_HEIGHT &&
+      m_clamped_drawing_area.rintersects(draw_rect_012))
+  {
+    AddDrawTriangleTicks(positions[0], positions[1], positions[2], rc.shading_enable, rc.texture_enable,
+                         rc.transparency_enable);
+  }
+
+  if (rc.quad_polygon)
+  {
+    const GSVector4i draw_rect_123 = GSVector4i(min_pos_12.min_i32(positions[3]))
+                                       .upl64(GSVector4i(max_pos_12.max_i32(positions[3])))
+                                       .add32(GSVector4i::cxpr(0, 0, 1, 1));
+    if (draw_rect_123.width() <= MAX_PRIMITIVE_WIDTH && draw_rect_123.height() <= MAX_PRIMITIVE_HEIGHT &&
+        m_clamped_drawing_area.rintersects(draw_rect_123))
+    {
+      AddDrawTriangleTicks(positions[2], positions[1], positions[3], rc.shading_enable, rc.texture_enable,
+                           rc.transparency_enable);
+    }
+  }
+}
+
+void GPU::SkipRenderCommand()
+{
+  const GPURenderCommand rc{m_render_command.bits};
+  switch (rc.primitive)
+  {
+    case GPUPrimitive::Polygon:
+    {
+      const u32 num_vertices = rc.quad_polygon ? 4 : 3;
+      std::array<GSVector2i, 4> positions;
+      for (u32 i = 0; i < num_vertices; i++)
+      {
+        if (rc.shading_enable && i > 0)
+          m_fifo.RemoveOne();
+        const GPUVertexPosition vp{FifoPop()};
+        positions[i] = GSVector2i(m_drawing_offset.x + vp.x, m_drawing_offset.y + vp.y);
+        if (rc.texture_enable)
+          m_fifo.RemoveOne();
+      }
+
+      AddDrawPolygonTicks(rc, positions.data());
+    }
+    break;
+
+    case GPUPrimitive::Rectangle:
+    {
+      const GPUVertexPosition vp{FifoPop()};
+      const s32 pos_x = TruncateGPUVertexPosition(m_drawing_offset.x + vp.x);
+      const s32 pos_y = TruncateGPUVertexPosition(m_drawing_offset.y + vp.y);
+      if (rc.texture_enable)
+        m_fifo.RemoveOne();
+
+      s32 width, height;
+      switch (rc.rectangle_size)
+      {
+        case GPUDrawRectangleSize::R1x1:
+          width = height = 1;
+          break;
+        case GPUDrawRectangleSize::R8x8:
+          width = height = 8;
+          break;
+        case GPUDrawRectangleSize::R16x16:
+          width = height = 16;
+          break;
+        default:
+        {
+          const u32 width_and_height = FifoPop();
+          width = static_cast<s32>(width_and_height & VRAM_WIDTH_MASK);
+          height = static_cast<s32>((width_and_height >> 16) & VRAM_HEIGHT_MASK);
+        }
+        break;
+      }
+
+      const GSVector4i rect = GSVector4i(pos_x, pos_y, pos_x + width, pos_y + height);
+      const GSVector4i clamped_rect = m_clamped_drawing_area.rintersect(rect);
+      if (!clamped_rect.rempty())
+        AddDrawRectangleTicks(clamped_rect, rc.texture_enable, rc.transparency_enable);
+    }
+    break;
+
+    case GPUPrimitive::Line:
+    {
+      // Poly-line vertices were buffered until the terminator was found.
+      const u32 num_vertices = rc.polyline ? GetPolyLineVertexCount() : 2;
+      u32 buffer_pos = 0;
+      const auto pop_vertex = [this, rc, &buffer_pos]() {
+        const GPUVertexPosition vp{rc.polyline ? m_blit_buffer[buffer_pos++] : FifoPop()};
+        return GSVector4i(m_drawing_offset.x + vp.x, m_drawing_offset.y + vp.y);
+      };
+
+      GSVector4i start_pos = pop_vertex();
+      for (u32 i = 1; i < num_vertices; i++)
+      {
+        if (rc.shading_enable)
+        {
+          if (rc.polyline)
+            buffer_pos++;
+          else
+            m_fifo.RemoveOne();
+        }
+
+        const GSVector4i end_pos = pop_vertex();
+        const GSVector4i rect =
+          start_pos.min_i32(end_pos).xyxy(start_pos.max_i32(end_pos)).add32(GSVector4i::cxpr(0, 0, 1, 1));
+        const GSVector4i clamped_rect = rect.rintersect(m_clamped_drawing_area);
+        if (rect.width() <= MAX_PRIMITIVE_WIDTH && rect.height() <= MAX_PRIMITIVE_HEIGHT && !clamped_rect.rempty())
+          AddDrawLineTicks(clamped_rect, rc.shading_enable);
+
+        start_pos = end_pos;
+      }
+    }
+    break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
 bool GPU::HandleFillRectangleCommand()
 {
   CHECK_COMMAND_SIZE(3);
@@ -179,6 +179,59 @@ private:
 };
 } // namespace
 
+class GPU_HW::Backend final : public GPUBackend
+{
+public:
+  explicit Backend(GPU_HW* gpu) : m_gpu(gpu) {}
+  ~Backend() override = default;
+
+  /// OpenGL contexts are bound to the thread which created them, so GL always executes on the CPU thread.
+  static bool ShouldUseThread()
+  {
+    const RenderAPI api = g_gpu_device->GetRenderAPI();
+    return (g_settings.gpu_use_hardware_thread && api != RenderAPI::OpenGL && api != RenderAPI::OpenGLES);
+  }
+
+  bool Initialize(bool force_thread) override
+  {
+    StartGPUThread();
+    return true;
+  }
+
+protected:
+  void FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params) override
+  {
+    m_gpu->FillVRAM(x, y, width, height, color, params);
+  }
+
+  void UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, GPUBackendCommandParameters params) override
+  {
+    m_gpu->UpdateVRAM(x, y, width, height, data, params);
+  }
+
+  void CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height,
+                GPUBackendCommandParameters params) override
+  {
+    m_gpu->CopyVRAM(src_x, src_y, dst_x, dst_y, width, height, params);
+  }
+
+  void DrawPolygon(const GPUBackendDrawPolygonCommand* cmd) override { UnreachableCode(); }
+  void DrawPrecisePolygon(const GPUBackendDrawPrecisePolygonCommand* cmd) override { m_gpu->DrawPrecisePolygon(cmd); }
+  void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd) override { m_gpu->DrawRectangle(cmd); }
+  void DrawLine(const GPUBackendDrawLineCommand* cmd) override { m_gpu->DrawLine(cmd); }
+  void FlushRender() override { m_gpu->FlushBatch(); }
+
+  void DrawingAreaChanged(const GPUDrawingArea& new_drawing_area, const GSVector4i clamped_drawing_area) override
+  {
+    m_gpu->DrawingAreaChanged(clamped_drawing_area);
+  }
+
+  void UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit) override {}
+
+private:
+  GPU_HW* m_gpu;
+};
+
 GPU_HW::GPU_HW() : GPU()
 {
 #ifdef _DEBUG
@@ -188,6 +241,10 @@ GPU_HW::GPU_HW() : GPU()
 
 GPU_HW::~GPU_HW()
 {
+  // Stop the backend thread before any of the resources it uses are released.
+  if (m_backend)
+    m_backend->Shutdown();
+
   if (m_sw_renderer)
   {
     m_sw_renderer->Shutdown();
@@ -204,15 +261,21 @@ ALWAYS_INLINE void GPU_HW::BatchVertex::Set(float x_, float y_, float z_, float
 ALWAYS_INLINE void GPU_HW::BatchVertex::Set(float x_, float y_, float z_, float w_, u32 color_, u32 texpage_, u16 u_,
                                             u16 v_, u32 uv_limits_)
 {
-  x = x_;
-  y = y_;
-  z = z_;
-  w = w_;
-  color = color_;
-  texpage = texpage_;
-  u = u_;
-  v = v_;
-  uv_limits = uv_limits_;
+  SetPosition(GSVector4(x_, y_, z_, w_));
+  SetAttributes(GSVector4i(static_cast<s32>(color_), static_cast<s32>(texpage_),
+                           static_cast<s32>(ZeroExtend32(u_) | (ZeroExtend32(v_) << 16)), static_cast<s32>(uv_limits_)));
+}
+
+ALWAYS_INLINE void GPU_HW::BatchVertex::SetPosition(const GSVector4 xyzw)
+{
+  static_assert(offsetof(BatchVertex, w) == (offsetof(BatchVertex, x) + sizeof(float) * 3));
+  GSVector4::store<false>(&x, xyzw);
+}
+
+ALWAYS_INLINE void GPU_HW::BatchVertex::SetAttributes(const GSVector4i color_texpage_uv_limits)
+{
+  static_assert(offsetof(BatchVertex, uv_limits) == (offsetof(BatchVertex, color) + sizeof(u32) * 3));
+  GSVector4i::store<false>(&color, color_texpage_uv_limits);
 }
 
 ALWAYS_INLINE u32 GPU_HW::BatchVertex::PackUVLimits(u32 min_u, u32 max_u, u32 min_v, u32 max_v)
@@ -225,6 +288,97 @@ ALWAYS_INLINE void GPU_HW::BatchVertex::SetUVLimits(u32 min_u, u32 max_u, u32 mi
   uv_limits = PackUVLimits(min_u, max_u, min_v, max_v);
 }
 
+void GPU_HW::VRAMDirtyTiles::Clear()
+{
+  rows.fill(0);
+  row_mask = 0;
+}
+
+void GPU_HW::VRAMDirtyTiles::SetAll()
+{
+  rows.fill(~static_cast<u64>(0));
+  row_mask = (NUM_ROWS == 32) ? ~0u : ((1u << NUM_ROWS) - 1u);
+}
+
+ALWAYS_INLINE_RELEASE bool GPU_HW::VRAMDirtyTiles::GetTileRange(GSVector4i rect, u64* col_mask, u32* first_row,
+                                                                u32* last_row)
+{
+  rect = rect.rintersect(VRAM_SIZE_RECT);
+  if (rect.rempty())
+    return false;
+
+  const u32 first_col = static_cast<u32>(rect.left) >> TILE_SHIFT;
+  const u32 last_col = static_cast<u32>(rect.right - 1) >> TILE_SHIFT;
+  *col_mask = (~static_cast<u64>(0) >> (63 - last_col)) & (~static_cast<u64>(0) << first_col);
+  *first_row = static_cast<u32>(rect.top) >> TILE_SHIFT;
+  *last_row = static_cast<u32>(rect.bottom - 1) >> TILE_SHIFT;
+  return true;
+}
+
+void GPU_HW::VRAMDirtyTiles::Add(const GSVector4i rect)
+{
+  u64 col_mask;
+  u32 first_row, last_row;
+  if (!GetTileRange(rect, &col_mask, &first_row, &last_row))
+    return;
+
+  for (u32 row = first_row; row <= last_row; row++)
+    rows[row] |= col_mask;
+  row_mask |= (~0u >> (31 - last_row)) & (~0u << first_row);
+}
+
+void GPU_HW::VRAMDirtyTiles::Add(const VRAMDirtyTiles& tiles)
+{
+  for (u32 row = 0; row < NUM_ROWS; row++)
+    rows[row] |= tiles.rows[row];
+  row_mask |= tiles.row_mask;
+}
+
+bool GPU_HW::VRAMDirtyTiles::Intersects(const GSVector4i rect) const
+{
+  u64 col_mask;
+  u32 first_row, last_row;
+  if (!GetTileRange(rect, &col_mask, &first_row, &last_row) ||
+      !(row_mask & (~0u >> (31 - last_row)) & (~0u << first_row)))
+  {
+    return false;
+  }
+
+  for (u32 row = first_row; row <= last_row; row++)
+  {
+    if (rows[row] & col_mask)
+      return true;
+  }
+
+  return false;
+}
+
+template<typename T>
+void GPU_HW::VRAMDirtyTiles::EnumerateRects(const T& callback) const
+{
+  u32 pending = row_mask;
+  while (pending != 0)
+  {
+    const u32 first_row = CountTrailingZeros(pending);
+    const u64 cols = rows[first_row];
+    const u32 left = CountTrailingZeros(cols);
+    const u32 right = 64 - CountLeadingZeros(cols);
+
+    // extend downwards while the rows cover the same columns
+    u32 end_row = first_row + 1;
+    while (end_row < NUM_ROWS && rows[end_row] != 0 && CountTrailingZeros(rows[end_row]) == left &&
+           (64 - CountLeadingZeros(rows[end_row])) == right)
+    {
+      end_row++;
+    }
+
+    callback(GSVector4i(static_cast<s32>(left << TILE_SHIFT), static_cast<s32>(first_row << TILE_SHIFT),
+                        static_cast<s32>(right << TILE_SHIFT), static_cast<s32>(end_row << TILE_SHIFT)));
+
+    pending &= (end_row < 32) ? (~0u << end_row) : 0u;
+  }
+}
+
 const Threading::Thread* GPU_HW::GetSWThread() const
 {
   return m_sw_renderer ? m_sw_renderer->GetThread() : nullptr;
@@ -256,6 +410,7 @@ bool GPU_HW::Initialize()
   m_clamp_uvs = ShouldClampUVs(m_texture_filtering) || ShouldClampUVs(m_sprite_texture_filtering);
   m_compute_uv_range = m_clamp_uvs;
   m_allow_sprite_mode = ShouldAllowSpriteMode(m_resolution_scale, m_texture_filtering, m_sprite_texture_filtering);
+  m_pgxp_depth_clear_threshold = g_settings.gpu_pgxp_depth_clear_threshold;
 
   CheckSettings();
 
@@ -277,14 +432,19 @@ bool GPU_HW::Initialize()
   }
 
   UpdateDownsamplingLevels();
-  RestoreDeviceContext();
+  RestoreDeviceState();
+  UpdateBackendThread();
   return true;
 }
 
 void GPU_HW::Reset(bool clear_vram)
 {
+  SyncBackend(false);
+
   if (m_batch_vertex_ptr)
     UnmapGPUBuffer(0, 0);
+  m_num_batch_splits = 0;
+  FlushVRAMWrites();
 
   GPU::Reset(clear_vram);
 
@@ -296,6 +456,7 @@ void GPU_HW::Reset(bool clear_vram)
   m_batch_ubo_dirty = true;
   m_current_depth = 1;
   SetClampedDrawingArea();
+  CopyDrawStateToBackend();
 
   if (clear_vram)
     ClearFramebuffer();
@@ -303,6 +464,9 @@ void GPU_HW::Reset(bool clear_vram)
 
 bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display)
 {
+  SyncBackend(false);
+  FlushVRAMWrites();
+
   // Need to download local VRAM copy before calling the base class, because it serializes this.
   if (m_sw_renderer)
   {
@@ -376,17 +540,87 @@ bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
 }
 
 void GPU_HW::RestoreDeviceContext()
+{
+  SyncBackend(false);
+  RestoreDeviceState();
+}
+
+void GPU_HW::SyncRenderer()
+{
+  if (m_backend)
+    SyncBackend(true);
+  else
+    FlushBatch();
+}
+
+void GPU_HW::UpdateBackendThread()
+{
+  const bool use_thread = Backend::ShouldUseThread();
+  if (use_thread == static_cast<bool>(m_backend))
+    return;
+
+  if (!use_thread)
+  {
+    INFO_LOG("Stopping hardware renderer thread.");
+    SyncBackend(false);
+    m_backend->Shutdown();
+    m_backend.reset();
+
+    // The batch state was last set from a queued command, so re-check it against the emulation state.
+    m_draw_mode.SetTexturePageChanged();
+    m_draw_mode.SetTextureWindowChanged();
+    return;
+  }
+
+  INFO_LOG("Starting hardware renderer thread.");
+  FlushBatch();
+  CopyDrawStateToBackend();
+  m_backend = std::make_unique<Backend>(this);
+  m_backend->Initialize(false);
+}
+
+void GPU_HW::CopyDrawStateToBackend()
+{
+  m_backend_drawing_area = m_clamped_drawing_area;
+  m_backend_draw_mode.bits = m_draw_mode.mode_reg.bits;
+  m_backend_palette_reg.bits = m_draw_mode.palette_reg.bits;
+  m_backend_texture_page_changed = true;
+  m_backend_texture_window_changed = true;
+}
+
+void GPU_HW::PushBackendCommand(GPUBackendCommand* cmd)
+{
+  m_backend->PushCommand(cmd);
+  m_backend_commands_queued = true;
+}
+
+void GPU_HW::SyncBackend(bool allow_sleep)
+{
+  if (!m_backend_commands_queued)
+    return;
+
+  // The flush ensures the batch is drawn before the device is used by the caller.
+  m_backend->PushCommand(m_backend->NewFlushRenderCommand());
+  m_backend->Sync(allow_sleep);
+  m_backend_commands_queued = false;
+}
+
+void GPU_HW::RestoreDeviceState()
 {
   g_gpu_device->SetTextureSampler(0, m_vram_read_texture.get(), g_gpu_device->GetNearestSampler());
   SetVRAMRenderTarget();
   g_gpu_device->SetViewport(m_vram_texture->GetRect());
   SetScissor();
   m_batch_ubo_dirty = true;
+  if (m_num_batch_splits > 0)
+    m_batch_splits[0].ubo_dirty = true;
 }
 
 void GPU_HW::UpdateSettings(const Settings& old_settings)
 {
+  SyncBackend(false);
   GPU::UpdateSettings(old_settings);
+  FlushVRAMWrites();
 
   const GPUDevice::Features features = g_gpu_device->GetFeatures();
 
@@ -448,7 +682,7 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
   // Back up VRAM if we're recreating the framebuffer.
   if (framebuffer_changed)
   {
-    RestoreDeviceContext();
+    RestoreDeviceState();
     ReadVRAM(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
     DestroyBuffers();
   }
@@ -465,6 +699,7 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
   m_compute_uv_range = m_clamp_uvs;
   m_allow_sprite_mode = ShouldAllowSpriteMode(resolution_scale, m_texture_filtering, m_sprite_texture_filtering);
   m_batch.sprite_mode = (m_allow_sprite_mode && m_batch.sprite_mode);
+  m_pgxp_depth_clear_threshold = g_settings.gpu_pgxp_depth_clear_threshold;
 
   const bool depth_buffer_changed = (m_pgxp_depth_buffer != g_settings.UsingPGXPDepthBuffer());
   if (depth_buffer_changed)
@@ -503,8 +738,11 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
       Panic("Failed to recreate buffers.");
 
     UpdateDownsamplingLevels();
-    RestoreDeviceContext();
-    UpdateVRAM(0, 0, VRAM_WIDTH, VRAM_HEIGHT, g_vram, false, false);
+    RestoreDeviceState();
+
+    GPUBackendCommandParameters params;
+    params.bits = 0;
+    UpdateVRAM(0, 0, VRAM_WIDTH, VRAM_HEIGHT, g_vram, params);
     if (m_write_mask_as_depth)
       UpdateDepthBufferFromMaskBit();
     UpdateDisplay();
@@ -523,6 +761,8 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
   {
     UpdateDownsamplingLevels();
   }
+
+  UpdateBackendThread();
 }
 
 void GPU_HW::CheckSettings()
@@ -706,22 +946,54 @@ bool GPU_HW::IsUsingDownsampling() const
   return (m_downsample_mode != GPUDownsampleMode::Disabled && !m_GPUSTAT.display_area_color_depth_24);
 }
 
+ALWAYS_INLINE const GSVector4i& GPU_HW::GetBatchDrawingArea() const
+{
+  return m_backend ? m_backend_drawing_area : m_clamped_drawing_area;
+}
+
+ALWAYS_INLINE const GPUDrawModeReg& GPU_HW::GetBatchDrawMode() const
+{
+  return m_backend ? m_backend_draw_mode : m_draw_mode.mode_reg;
+}
+
+ALWAYS_INLINE const GPUTexturePaletteReg& GPU_HW::GetBatchPaletteReg() const
+{
+  return m_backend ? m_backend_palette_reg : m_draw_mode.palette_reg;
+}
+
+ALWAYS_INLINE bool GPU_HW::IsBatchTexturePageChanged() const
+{
+  return m_backend ? m_backend_texture_page_changed : m_draw_mode.IsTexturePageChanged();
+}
+
+ALWAYS_INLINE void GPU_HW::SetBatchTexturePageChanged()
+{
+  if (m_backend)
+    m_backend_texture_page_changed = true;
+  else
+    m_draw_mode.SetTexturePageChanged();
+}
+
 void GPU_HW::SetFullVRAMDirtyRectangle()
 {
   m_vram_dirty_draw_rect = VRAM_SIZE_RECT;
-  m_draw_mode.SetTexturePageChanged();
+  m_vram_dirty_draw_tiles.SetAll();
+  SetBatchTexturePageChanged();
 }
 
 void GPU_HW::ClearVRAMDirtyRectangle()
 {
   m_vram_dirty_draw_rect = INVALID_RECT;
   m_vram_dirty_write_rect = INVALID_RECT;
+  m_vram_dirty_draw_tiles.Clear();
+  m_vram_dirty_write_tiles.Clear();
 }
 
 void GPU_HW::AddWrittenRectangle(const GSVector4i rect)
 {
   m_vram_dirty_write_rect = m_vram_dirty_write_rect.runion(rect);
-  SetTexPageChangedOnOverlap(m_vram_dirty_write_rect);
+  m_vram_dirty_write_tiles.Add(rect);
+  SetTexPageChangedOnOverlap(m_vram_dirty_write_rect, m_vram_dirty_write_tiles);
 }
 
 void GPU_HW::AddDrawnRectangle(const GSVector4i rect)
@@ -730,27 +1002,49 @@ void GPU_HW::AddDrawnRectangle(const GSVector4i rect)
   // changes, or it samples a larger region, so we can get away without doing so. This reduces copies considerably in
   // games like Mega Man Legends 2.
   m_vram_dirty_draw_rect = m_vram_dirty_draw_rect.runion(rect);
+  m_vram_dirty_draw_tiles.Add(rect);
 }
 
 void GPU_HW::AddUnclampedDrawnRectangle(const GSVector4i rect)
 {
   m_vram_dirty_draw_rect = m_vram_dirty_draw_rect.runion(rect);
-  SetTexPageChangedOnOverlap(m_vram_dirty_draw_rect);
+  m_vram_dirty_draw_tiles.Add(rect);
+  SetTexPageChangedOnOverlap(m_vram_dirty_draw_rect, m_vram_dirty_draw_tiles);
 }
 
-void GPU_HW::SetTexPageChangedOnOverlap(const GSVector4i update_rect)
+void GPU_HW::SetTexPageChangedOnOverlap(const GSVector4i update_rect, const VRAMDirtyTiles& update_tiles)
 {
   // the vram area can include the texture page, but the game can leave it as-is. in this case, set it as dirty so the
   // shadow texture is updated
-  if (!m_draw_mode.IsTexturePageChanged() && m_batch.texture_mode != BatchTextureMode::Disabled &&
-      (m_draw_mode.mode_reg.GetTexturePageRectangle().rintersects(update_rect) ||
-       (m_draw_mode.mode_reg.IsUsingPalette() &&
-        m_draw_mode.palette_reg.GetRectangle(m_draw_mode.mode_reg.texture_mode).rintersects(update_rect))))
+  if (IsBatchTexturePageChanged() || m_batch.texture_mode == BatchTextureMode::Disabled)
+    return;
+
+  const GPUDrawModeReg& mode_reg = GetBatchDrawMode();
+  const GSVector4i page_rect = mode_reg.GetTexturePageRectangle();
+  if (page_rect.rintersects(update_rect) && update_tiles.Intersects(page_rect))
   {
-    m_draw_mode.SetTexturePageChanged();
+    SetBatchTexturePageChanged();
+    return;
+  }
+
+  if (mode_reg.IsUsingPalette())
+  {
+    const GSVector4i palette_rect = GetBatchPaletteReg().GetRectangle(mode_reg.texture_mode);
+    if (palette_rect.rintersects(update_rect) && update_tiles.Intersects(palette_rect))
+      SetBatchTexturePageChanged();
   }
 }
 
+ALWAYS_INLINE_RELEASE bool GPU_HW::IntersectsDirtyDrawArea(const GSVector4i rect) const
+{
+  return m_vram_dirty_draw_rect.rintersects(rect) && m_vram_dirty_draw_tiles.Intersects(rect);
+}
+
+ALWAYS_INLINE_RELEASE bool GPU_HW::IntersectsDirtyWriteArea(const GSVector4i rect) const
+{
+  return m_vram_dirty_write_rect.rintersects(rect) && m_vram_dirty_write_tiles.Intersects(rect);
+}
+
 std::tuple<u32, u32> GPU_HW::GetEffectiveDisplayResolution(bool scaled /* = true */)
 {
   const u32 scale = scaled ? m_resolution_scale : 1u;
@@ -866,6 +1160,7 @@ bool GPU_HW::CreateBuffers()
     }
 
     GL_OBJECT_NAME(m_vram_upload_buffer, "VRAM Upload Buffer");
+    m_vram_write_staging.resize(VRAM_WRITE_STAGING_PIXELS);
   }
 
   INFO_LOG("Created HW framebuffer of {}x{}", texture_width, texture_height);
@@ -925,6 +1220,9 @@ void GPU_HW::DestroyBuffers()
   if (m_batch_vertex_ptr)
     UnmapGPUBuffer(0, 0);
 
+  // anything still pending is lost with the texture
+  m_num_pending_vram_writes = 0;
+  m_vram_write_staging_used = 0;
   m_vram_upload_buffer.reset();
   m_vram_readback_download_texture.reset();
   g_gpu_device->RecycleTexture(std::move(m_downsample_texture));
@@ -1665,7 +1963,7 @@ void GPU_HW::UpdateVRAMReadTexture(bool drawn, bool written)
 {
   GL_SCOPE("UpdateVRAMReadTexture()");
 
-  const auto update = [this](GSVector4i& rect, u8 dbit) {
+  const auto update = [this](GSVector4i& rect, VRAMDirtyTiles& tiles, u8 dbit) {
     if (m_texpage_dirty & dbit)
     {
       m_texpage_dirty &= ~dbit;
@@ -1673,30 +1971,37 @@ void GPU_HW::UpdateVRAMReadTexture(bool drawn, bool written)
         GL_INS_FMT("{} texpage is no longer dirty", (dbit & TEXPAGE_DIRTY_DRAWN_RECT) ? "DRAW" : "WRITE");
     }
 
-    const GSVector4i scaled_rect = rect.mul32l(GSVector4i(m_resolution_scale));
-    if (m_vram_texture->IsMultisampled())
+    if (m_vram_texture->IsMultisampled() && !g_gpu_device->GetFeatures().partial_msaa_resolve)
     {
-      if (g_gpu_device->GetFeatures().partial_msaa_resolve)
-      {
-        g_gpu_device->ResolveTextureRegion(m_vram_read_texture.get(), scaled_rect.left, scaled_rect.top, 0, 0,
-                                           m_vram_texture.get(), scaled_rect.left, scaled_rect.top, scaled_rect.width(),
-                                           scaled_rect.height());
-      }
-      else
-      {
-        g_gpu_device->ResolveTextureRegion(m_vram_read_texture.get(), 0, 0, 0, 0, m_vram_texture.get(), 0, 0,
-                                           m_vram_texture->GetWidth(), m_vram_texture->GetHeight());
-      }
+      g_gpu_device->ResolveTextureRegion(m_vram_read_texture.get(), 0, 0, 0, 0, m_vram_texture.get(), 0, 0,
+                                         m_vram_texture->GetWidth(), m_vram_texture->GetHeight());
     }
     else
     {
-      g_gpu_device->CopyTextureRegion(m_vram_read_texture.get(), scaled_rect.left, scaled_rect.top, 0, 0,
-                                      m_vram_texture.get(), scaled_rect.left, scaled_rect.top, 0, 0,
-                                      scaled_rect.width(), scaled_rect.height());
+      // only copy the dirty tiles, so that distant updates don't pull in everything in between
+      tiles.EnumerateRects([this, &rect](const GSVector4i tile_rect) {
+        const GSVector4i scaled_rect = tile_rect.rintersect(rect).mul32l(GSVector4i(m_resolution_scale));
+        if (scaled_rect.rempty())
+          return;
+
+        if (m_vram_texture->IsMultisampled())
+        {
+          g_gpu_device->ResolveTextureRegion(m_vram_read_texture.get(), scaled_rect.left, scaled_rect.top, 0, 0,
+                                             m_vram_texture.get(), scaled_rect.left, scaled_rect.top,
+                                             scaled_rect.width(), scaled_rect.height());
+        }
+        else
+        {
+          g_gpu_device->CopyTextureRegion(m_vram_read_texture.get(), scaled_rect.left, scaled_rect.top, 0, 0,
+                                          m_vram_texture.get(), scaled_rect.left, scaled_rect.top, 0, 0,
+                                          scaled_rect.width(), scaled_rect.height());
+        }
+      });
     }
 
     // m_counters.num_read_texture_updates++;
     rect = INVALID_RECT;
+    tiles.Clear();
   };
 
   if (drawn)
@@ -1710,17 +2015,19 @@ void GPU_HW::UpdateVRAMReadTexture(bool drawn, bool written)
       DebugAssert(!m_vram_dirty_write_rect.eq(INVALID_RECT));
       GL_INS_FMT("Including write rect {}", m_vram_dirty_write_rect);
       m_vram_dirty_draw_rect = m_vram_dirty_draw_rect.runion(m_vram_dirty_write_rect);
+      m_vram_dirty_draw_tiles.Add(m_vram_dirty_write_tiles);
       m_vram_dirty_write_rect = INVALID_RECT;
+      m_vram_dirty_write_tiles.Clear();
       dbits = TEXPAGE_DIRTY_DRAWN_RECT | TEXPAGE_DIRTY_WRITTEN_RECT;
       written = false;
     }
 
-    update(m_vram_dirty_draw_rect, dbits);
+    update(m_vram_dirty_draw_rect, m_vram_dirty_draw_tiles, dbits);
   }
   if (written)
   {
     GL_INS_FMT("Updating write rect {}", m_vram_dirty_write_rect);
-    update(m_vram_dirty_write_rect, TEXPAGE_DIRTY_WRITTEN_RECT);
+    update(m_vram_dirty_write_rect, m_vram_dirty_write_tiles, TEXPAGE_DIRTY_WRITTEN_RECT);
   }
 }
 
@@ -1763,7 +2070,7 @@ void GPU_HW::CopyAndClearDepthBuffer()
       const float uniforms[4] = {0.0f, 0.0f, 1.0f, 1.0f};
       g_gpu_device->PushUniformBuffer(uniforms, sizeof(uniforms));
       g_gpu_device->Draw(3, 0);
-      RestoreDeviceContext();
+      RestoreDeviceState();
     }
 
     m_depth_was_copied = true;
@@ -1785,7 +2092,7 @@ void GPU_HW::ClearDepthBuffer()
 
 void GPU_HW::SetScissor()
 {
-  g_gpu_device->SetScissor(m_clamped_drawing_area.mul32l(GSVector4i(m_resolution_scale)));
+  g_gpu_device->SetScissor(GetBatchDrawingArea().mul32l(GSVector4i(m_resolution_scale)));
 }
 
 void GPU_HW::MapGPUBuffer(u32 required_vertices, u32 required_indices)
@@ -1814,6 +2121,7 @@ void GPU_HW::UnmapGPUBuffer(u32 used_vertices, u32 used_indices)
   m_batch_index_ptr = nullptr;
   m_batch_index_count = 0;
   m_batch_index_space = 0;
+  m_batch_split_start_index = 0;
 }
 
 ALWAYS_INLINE_RELEASE void GPU_HW::DrawBatchVertices(BatchRenderMode render_mode, u32 num_indices, u32 base_index,
@@ -2191,7 +2499,7 @@ void GPU_HW::SetBatchDepthBuffer(bool enabled)
 
   if (m_batch_index_count > 0)
   {
-    FlushRender();
+    FlushBatch();
     EnsureVertexBufferSpaceForCurrentCommand();
   }
 
@@ -2207,9 +2515,9 @@ void GPU_HW::CheckForDepthClear(const BatchVertex* vertices, u32 num_vertices)
   else
     average_z = std::min((vertices[0].w + vertices[1].w + vertices[2].w + vertices[3].w) / 4.0f, 1.0f);
 
-  if ((average_z - m_last_depth_z) >= g_settings.gpu_pgxp_depth_clear_threshold)
+  if ((average_z - m_last_depth_z) >= m_pgxp_depth_clear_threshold)
   {
-    FlushRender();
+    FlushBatch();
     CopyAndClearDepthBuffer();
     EnsureVertexBufferSpaceForCurrentCommand();
   }
@@ -2224,7 +2532,7 @@ void GPU_HW::SetBatchSpriteMode(bool enabled)
 
   if (m_batch_index_count > 0)
   {
-    FlushRender();
+    SplitBatch();
     EnsureVertexBufferSpaceForCurrentCommand();
   }
 
@@ -2429,6 +2737,8 @@ void GPU_HW::LoadVertices()
         m_sw_renderer->PushCommand(cmd);
       }
 
+      AddDrawPolygonTicks(rc, native_vertex_positions.data());
+
       // Cull polygons which are too large.
       const GSVector2 v0f = GSVector2::load(&vertices[0].x);
       const GSVector2 v1f = GSVector2::load(&vertices[1].x);
@@ -2455,8 +2765,6 @@ void GPU_HW::LoadVertices()
           ComputePolygonUVLimits(vertices.data(), num_vertices);
 
         AddDrawnRectangle(clamped_draw_rect_012);
-        AddDrawTriangleTicks(native_vertex_positions[0], native_vertex_positions[1], native_vertex_positions[2],
-                             rc.shading_enable, rc.texture_enable, rc.transparency_enable);
 
         // Expand lines to triangles (Doom, Soul Blade, etc.)
         if (!rc.quad_polygon && m_line_detect_mode >= GPULineDetectMode::BasicTriangles && !is_3d &&
@@ -2501,8 +2809,6 @@ void GPU_HW::LoadVertices()
             ComputePolygonUVLimits(vertices.data(), num_vertices);
 
           AddDrawnRectangle(clamped_draw_rect_123);
-          AddDrawTriangleTicks(native_vertex_positions[2], native_vertex_positions[1], native_vertex_positions[3],
-                               rc.shading_enable, rc.texture_enable, rc.transparency_enable);
 
           const u32 start_index = m_batch_vertex_count;
           DebugAssert(m_batch_index_space >= 3);
@@ -2584,6 +2890,8 @@ void GPU_HW::LoadVertices()
                   m_batch_index_space >= MAX_VERTICES_FOR_RECTANGLE);
 
       // Split the rectangle into multiple quads if it's greater than 256x256, as the texture page should repeat.
+      // Each quad's vertices are built from the start/end corners with blends, rather than field-by-field.
+      const GSVector4i color_texpage = GSVector4i(static_cast<s32>(color), static_cast<s32>(texpage), 0, 0);
       u32 tex_top = orig_tex_top;
       for (u32 y_offset = 0; y_offset < rectangle_height;)
       {
@@ -2607,28 +2915,31 @@ void GPU_HW::LoadVertices()
                                               static_cast<s32>(tex_right), static_cast<s32>(tex_bottom)));
           }
 
+          const GSVector4 start_pos = GSVector4(quad_start_x, quad_start_y, depth, 1.0f);
+          const GSVector4 end_pos = GSVector4(quad_end_x, quad_end_y, depth, 1.0f);
+          const GSVector4i attributes = color_texpage.insert32<3>(static_cast<s32>(uv_limits));
+
+          BatchVertex* const vertices = m_batch_vertex_ptr;
+          vertices[0].SetPosition(start_pos);
+          vertices[0].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_left | (tex_top << 16))));
+          vertices[1].SetPosition(start_pos.blend32<1>(end_pos));
+          vertices[1].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_right | (tex_top << 16))));
+          vertices[2].SetPosition(start_pos.blend32<2>(end_pos));
+          vertices[2].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_left | (tex_bottom << 16))));
+          vertices[3].SetPosition(end_pos);
+          vertices[3].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_right | (tex_bottom << 16))));
+
           const u32 base_vertex = m_batch_vertex_count;
-          (m_batch_vertex_ptr++)
-            ->Set(quad_start_x, quad_start_y, depth, 1.0f, color, texpage, Truncate16(tex_left), Truncate16(tex_top),
-                  uv_limits);
-          (m_batch_vertex_ptr++)
-            ->Set(quad_end_x, quad_start_y, depth, 1.0f, color, texpage, Truncate16(tex_right), Truncate16(tex_top),
-                  uv_limits);
-          (m_batch_vertex_ptr++)
-            ->Set(quad_start_x, quad_end_y, depth, 1.0f, color, texpage, Truncate16(tex_left), Truncate16(tex_bottom),
-                  uv_limits);
-          (m_batch_vertex_ptr++)
-            ->Set(quad_end_x, quad_end_y, depth, 1.0f, color, texpage, Truncate16(tex_right), Truncate16(tex_bottom),
-                  uv_limits);
+          m_batch_vertex_ptr += 4;
           m_batch_vertex_count += 4;
           m_batch_vertex_space -= 4;
 
-          *(m_batch_index_ptr++) = Truncate16(base_vertex + 0);
-          *(m_batch_index_ptr++) = Truncate16(base_vertex + 1);
-          *(m_batch_index_ptr++) = Truncate16(base_vertex + 2);
-          *(m_batch_index_ptr++) = Truncate16(base_vertex + 2);
-          *(m_batch_index_ptr++) = Truncate16(base_vertex + 1);
-          *(m_batch_index_ptr++) = Truncate16(base_vertex + 3);
+          // 0,1,2 2,1,3 - written as 4+2 indices, so we don't write past the end of the buffer.
+          const GSVector4i indices = GSVector4i::cxpr16(0, 1, 2, 2, 1, 3, 0, 0)
+                                       .add16(GSVector4i(static_cast<s32>(base_vertex | (base_vertex << 16))));
+          GSVector4i::storel(m_batch_index_ptr, indices);
+          GSVector4i::store32(m_batch_index_ptr + 4, indices.zwzw());
+          m_batch_index_ptr += 6;
           m_batch_index_count += 6;
           m_batch_index_space -= 6;
 
@@ -2782,6 +3093,277 @@ void GPU_HW::LoadVertices()
   }
 }
 
+void GPU_HW::DrawPrecisePolygon(const GPUBackendDrawPrecisePolygonCommand* cmd)
+{
+  // assume quad, in case of expansion
+  PrepareDraw(cmd, 4, 6);
+
+  if (cmd->params.check_mask_before_draw)
+    m_current_depth++;
+
+  const GPURenderCommand rc{cmd->rc.bits};
+  const u32 texpage = ZeroExtend32(cmd->draw_mode.bits) | (ZeroExtend32(cmd->palette.bits) << 16);
+  const float depth = GetCurrentNormalizedVertexDepth();
+  const bool textured = rc.texture_enable;
+  const bool pgxp = cmd->pgxp;
+
+  const u32 num_vertices = cmd->num_vertices;
+  std::array<BatchVertex, 4> vertices;
+  for (u32 i = 0; i < num_vertices; i++)
+  {
+    const GPUBackendDrawPrecisePolygonCommand::Vertex& vert = cmd->vertices[i];
+    vertices[i].Set(vert.x, vert.y, depth, vert.w, vert.color, texpage, vert.texcoord, 0xFFFF0000u);
+  }
+
+  if (pgxp)
+  {
+    if (!cmd->valid_w)
+    {
+      SetBatchDepthBuffer(false);
+    }
+    else if (m_pgxp_depth_buffer)
+    {
+      SetBatchDepthBuffer(true);
+      CheckForDepthClear(vertices.data(), num_vertices);
+    }
+  }
+
+  // Use PGXP to exclude primitives that are definitely 3D.
+  const bool is_3d = (vertices[0].w != vertices[1].w || vertices[0].w != vertices[2].w);
+  if (m_resolution_scale > 1 && !is_3d && rc.quad_polygon)
+    HandleFlippedQuadTextureCoordinates(vertices.data());
+  else if (m_allow_sprite_mode)
+    SetBatchSpriteMode((pgxp && !is_3d) || IsPossibleSpritePolygon(vertices.data()));
+
+  // Cull polygons which are too large.
+  const GSVector2 v0f = GSVector2::load(&vertices[0].x);
+  const GSVector2 v1f = GSVector2::load(&vertices[1].x);
+  const GSVector2 v2f = GSVector2::load(&vertices[2].x);
+  const GSVector2 min_pos_12 = v1f.min(v2f);
+  const GSVector2 max_pos_12 = v1f.max(v2f);
+  const GSVector4i draw_rect_012 = GSVector4i(GSVector4(min_pos_12.min(v0f)).upld(GSVector4(max_pos_12.max(v0f))))
+                                     .add32(GSVector4i::cxpr(0, 0, 1, 1));
+  const GSVector4i clamped_draw_rect_012 = draw_rect_012.rintersect(m_backend_drawing_area);
+  const bool first_tri_culled = (draw_rect_012.width() > MAX_PRIMITIVE_WIDTH ||
+                                 draw_rect_012.height() > MAX_PRIMITIVE_HEIGHT || clamped_draw_rect_012.rempty());
+  if (first_tri_culled)
+  {
+    GL_INS_FMT("Culling off-screen/too-large polygon: {},{} {},{} {},{}", vertices[0].x, vertices[0].y, vertices[1].x,
+               vertices[1].y, vertices[2].x, vertices[2].y);
+
+    if (!rc.quad_polygon)
+      return;
+  }
+  else
+  {
+    if (textured && m_compute_uv_range)
+      ComputePolygonUVLimits(vertices.data(), num_vertices);
+
+    AddDrawnRectangle(clamped_draw_rect_012);
+
+    // Expand lines to triangles (Doom, Soul Blade, etc.)
+    if (!rc.quad_polygon && m_line_detect_mode >= GPULineDetectMode::BasicTriangles && !is_3d &&
+        ExpandLineTriangles(vertices.data()))
+    {
+      return;
+    }
+
+    const u32 start_index = m_batch_vertex_count;
+    DebugAssert(m_batch_index_space >= 3);
+    *(m_batch_index_ptr++) = Truncate16(start_index);
+    *(m_batch_index_ptr++) = Truncate16(start_index + 1);
+    *(m_batch_index_ptr++) = Truncate16(start_index + 2);
+    m_batch_index_count += 3;
+    m_batch_index_space -= 3;
+  }
+
+  // quads
+  if (rc.quad_polygon)
+  {
+    const GSVector2 v3f = GSVector2::load(&vertices[3].x);
+    const GSVector4i draw_rect_123 = GSVector4i(GSVector4(min_pos_12.min(v3f)).upld(GSVector4(max_pos_12.max(v3f))))
+                                       .add32(GSVector4i::cxpr(0, 0, 1, 1));
+    const GSVector4i clamped_draw_rect_123 = draw_rect_123.rintersect(m_backend_drawing_area);
+
+    // Cull polygons which are too large.
+    const bool second_tri_culled =
+      (draw_rect_123.width() > MAX_PRIMITIVE_WIDTH || draw_rect_123.height() > MAX_PRIMITIVE_HEIGHT ||
+       clamped_draw_rect_123.rempty());
+    if (second_tri_culled)
+    {
+      GL_INS_FMT("Culling off-screen/too-large polygon (quad second half): {},{} {},{} {},{}", vertices[2].x,
+                 vertices[2].y, vertices[1].x, vertices[1].y, vertices[0].x, vertices[0].y);
+
+      if (first_tri_culled)
+        return;
+    }
+    else
+    {
+      if (first_tri_culled && textured && m_compute_uv_range)
+        ComputePolygonUVLimits(vertices.data(), num_vertices);
+
+      AddDrawnRectangle(clamped_draw_rect_123);
+
+      const u32 start_index = m_batch_vertex_count;
+      DebugAssert(m_batch_index_space >= 3);
+      *(m_batch_index_ptr++) = Truncate16(start_index + 2);
+      *(m_batch_index_ptr++) = Truncate16(start_index + 1);
+      *(m_batch_index_ptr++) = Truncate16(start_index + 3);
+      m_batch_index_count += 3;
+      m_batch_index_space -= 3;
+    }
+  }
+
+  if (num_vertices == 4)
+  {
+    DebugAssert(m_batch_vertex_space >= 4);
+    std::memcpy(m_batch_vertex_ptr, vertices.data(), sizeof(BatchVertex) * 4);
+    m_batch_vertex_ptr += 4;
+    m_batch_vertex_count += 4;
+    m_batch_vertex_space -= 4;
+  }
+  else
+  {
+    DebugAssert(m_batch_vertex_space >= 3);
+    std::memcpy(m_batch_vertex_ptr, vertices.data(), sizeof(BatchVertex) * 3);
+    m_batch_vertex_ptr += 3;
+    m_batch_vertex_count += 3;
+    m_batch_vertex_space -= 3;
+  }
+}
+
+void GPU_HW::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
+{
+  PrepareDraw(cmd, MAX_VERTICES_FOR_RECTANGLE, MAX_VERTICES_FOR_RECTANGLE);
+
+  if (cmd->params.check_mask_before_draw)
+    m_current_depth++;
+
+  const GPURenderCommand rc{cmd->rc.bits};
+  const u32 texpage = ZeroExtend32(cmd->draw_mode.bits) | (ZeroExtend32(cmd->palette.bits) << 16);
+  const float depth = GetCurrentNormalizedVertexDepth();
+  const u32 color = cmd->color;
+  const s32 pos_x = cmd->x;
+  const s32 pos_y = cmd->y;
+
+  const auto [texcoord_x, texcoord_y] = UnpackTexcoord(cmd->texcoord);
+  const u32 orig_tex_left = ZeroExtend16(texcoord_x);
+  const u32 orig_tex_top = ZeroExtend16(texcoord_y);
+  const u32 rectangle_width = cmd->width;
+  const u32 rectangle_height = cmd->height;
+
+  // Off-screen rectangles are culled before they are queued.
+  const GSVector4i rect =
+    GSVector4i(pos_x, pos_y, pos_x + static_cast<s32>(rectangle_width), pos_y + static_cast<s32>(rectangle_height));
+  const GSVector4i clamped_rect = m_backend_drawing_area.rintersect(rect);
+
+  // we can split the rectangle up into potentially 8 quads
+  SetBatchDepthBuffer(false);
+  SetBatchSpriteMode(m_allow_sprite_mode);
+  DebugAssert(m_batch_vertex_space >= MAX_VERTICES_FOR_RECTANGLE && m_batch_index_space >= MAX_VERTICES_FOR_RECTANGLE);
+
+  // Split the rectangle into multiple quads if it's greater than 256x256, as the texture page should repeat.
+  // Each quad's vertices are built from the start/end corners with blends, rather than field-by-field.
+  const GSVector4i color_texpage = GSVector4i(static_cast<s32>(color), static_cast<s32>(texpage), 0, 0);
+  u32 tex_top = orig_tex_top;
+  for (u32 y_offset = 0; y_offset < rectangle_height;)
+  {
+    const s32 quad_height = std::min(rectangle_height - y_offset, TEXTURE_PAGE_WIDTH - tex_top);
+    const float quad_start_y = static_cast<float>(pos_y + static_cast<s32>(y_offset));
+    const float quad_end_y = quad_start_y + static_cast<float>(quad_height);
+    const u32 tex_bottom = tex_top + quad_height;
+
+    u32 tex_left = orig_tex_left;
+    for (u32 x_offset = 0; x_offset < rectangle_width;)
+    {
+      const s32 quad_width = std::min(rectangle_width - x_offset, TEXTURE_PAGE_HEIGHT - tex_left);
+      const float quad_start_x = static_cast<float>(pos_x + static_cast<s32>(x_offset));
+      const float quad_end_x = quad_start_x + static_cast<float>(quad_width);
+      const u32 tex_right = tex_left + quad_width;
+      const u32 uv_limits = BatchVertex::PackUVLimits(tex_left, tex_right - 1, tex_top, tex_bottom - 1);
+
+      if (rc.texture_enable && m_texpage_dirty != 0)
+      {
+        CheckForTexPageOverlap(GSVector4i(static_cast<s32>(tex_left), static_cast<s32>(tex_top),
+                                          static_cast<s32>(tex_right), static_cast<s32>(tex_bottom)));
+      }
+
+      const GSVector4 start_pos = GSVector4(quad_start_x, quad_start_y, depth, 1.0f);
+      const GSVector4 end_pos = GSVector4(quad_end_x, quad_end_y, depth, 1.0f);
+      const GSVector4i attributes = color_texpage.insert32<3>(static_cast<s32>(uv_limits));
+
+      BatchVertex* const vertices = m_batch_vertex_ptr;
+      vertices[0].SetPosition(start_pos);
+      vertices[0].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_left | (tex_top << 16))));
+      vertices[1].SetPosition(start_pos.blend32<1>(end_pos));
+      vertices[1].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_right | (tex_top << 16))));
+      vertices[2].SetPosition(start_pos.blend32<2>(end_pos));
+      vertices[2].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_left | (tex_bottom << 16))));
+      vertices[3].SetPosition(end_pos);
+      vertices[3].SetAttributes(attributes.insert32<2>(static_cast<s32>(tex_right | (tex_bottom << 16))));
+
+      const u32 base_vertex = m_batch_vertex_count;
+      m_batch_vertex_ptr += 4;
+      m_batch_vertex_count += 4;
+      m_batch_vertex_space -= 4;
+
+      // 0,1,2 2,1,3 - written as 4+2 indices, so we don't write past the end of the buffer.
+      const GSVector4i indices = GSVector4i::cxpr16(0, 1, 2, 2, 1, 3, 0, 0)
+                                   .add16(GSVector4i(static_cast<s32>(base_vertex | (base_vertex << 16))));
+      GSVector4i::storel(m_batch_index_ptr, indices);
+      GSVector4i::store32(m_batch_index_ptr + 4, indices.zwzw());
+      m_batch_index_ptr += 6;
+      m_batch_index_count += 6;
+      m_batch_index_space -= 6;
+
+      x_offset += quad_width;
+      tex_left = 0;
+    }
+
+    y_offset += quad_height;
+    tex_top = 0;
+  }
+
+  AddDrawnRectangle(clamped_rect);
+}
+
+void GPU_HW::DrawLine(const GPUBackendDrawLineCommand* cmd)
+{
+  // Multiply by two because we don't use line strips.
+  const u32 num_vertices = cmd->num_vertices;
+  PrepareDraw(cmd, num_vertices * 4, num_vertices * 6);
+
+  if (cmd->params.check_mask_before_draw)
+    m_current_depth++;
+
+  const float depth = GetCurrentNormalizedVertexDepth();
+
+  SetBatchDepthBuffer(false);
+  DebugAssert(m_batch_vertex_space >= (num_vertices * 4) && m_batch_index_space >= (num_vertices * 6));
+
+  for (u32 i = 1; i < num_vertices; i++)
+  {
+    const GPUBackendDrawLineCommand::Vertex& start = cmd->vertices[i - 1];
+    const GPUBackendDrawLineCommand::Vertex& end = cmd->vertices[i];
+    const GSVector4i start_pos = GSVector4i(start.x, start.y);
+    const GSVector4i end_pos = GSVector4i(end.x, end.y);
+    const GSVector4i bounds = start_pos.xyxy(end_pos);
+    const GSVector4i rect =
+      start_pos.min_i32(end_pos).xyxy(start_pos.max_i32(end_pos)).add32(GSVector4i::cxpr(0, 0, 1, 1));
+    const GSVector4i clamped_rect = rect.rintersect(m_backend_drawing_area);
+    if (rect.width() > MAX_PRIMITIVE_WIDTH || rect.height() > MAX_PRIMITIVE_HEIGHT || clamped_rect.rempty())
+    {
+      GL_INS_FMT("Culling too-large/off-screen line: {},{} - {},{}", start.x, start.y, end.x, end.y);
+      continue;
+    }
+
+    AddDrawnRectangle(clamped_rect);
+
+    // TODO: Should we do a PGXP lookup here? Most lines are 2D.
+    DrawLine(GSVector4(bounds), start.color, end.color, depth);
+  }
+}
+
 bool GPU_HW::BlitVRAMReplacementTexture(const TextureReplacements::ReplacementImage* tex, u32 dst_x, u32 dst_y,
                                         u32 width, u32 height)
 {
@@ -2808,6 +3390,7 @@ bool GPU_HW::BlitVRAMReplacementTexture(const TextureReplacements::ReplacementIm
 
   GL_SCOPE_FMT("BlitVRAMReplacementTexture() {}x{} to {},{} => {},{} ({}x{})", tex->GetWidth(), tex->GetHeight(), dst_x,
                dst_y, dst_x + width, dst_y + height, width, height);
+  FlushVRAMWrites();
 
   const float src_rect[4] = {
     0.0f, 0.0f, static_cast<float>(tex->GetWidth()) / static_cast<float>(m_vram_replacement_texture->GetWidth()),
@@ -2819,7 +3402,7 @@ bool GPU_HW::BlitVRAMReplacementTexture(const TextureReplacements::ReplacementIm
   g_gpu_device->PushUniformBuffer(src_rect, sizeof(src_rect));
   g_gpu_device->Draw(3, 0);
 
-  RestoreDeviceContext();
+  RestoreDeviceState();
   return true;
 }
 
@@ -2836,7 +3419,7 @@ ALWAYS_INLINE_RELEASE void GPU_HW::CheckForTexPageOverlap(GSVector4i uv_rect)
     uv_rect = uv_rect.min_i32(uv_rect.zwzw()).max_i32(uv_rect.xyxy());
   }
 
-  const GPUTextureMode tmode = m_draw_mode.mode_reg.texture_mode;
+  const GPUTextureMode tmode = GetBatchDrawMode().texture_mode;
   const u32 xshift = (tmode >= GPUTextureMode::Direct16Bit) ? 0 : (2 - static_cast<u8>(tmode));
   const GSVector4i page_offset = GSVector4i::loadl(m_current_texture_page_offset).xyxy();
 
@@ -2855,7 +3438,7 @@ ALWAYS_INLINE_RELEASE void GPU_HW::CheckForTexPageOverlap(GSVector4i uv_rect)
     if (m_texpage_dirty & TEXPAGE_DIRTY_DRAWN_RECT)
     {
       DebugAssert(!m_vram_dirty_draw_rect.eq(INVALID_RECT));
-      update_drawn = m_current_uv_rect.rintersects(m_vram_dirty_draw_rect);
+      update_drawn = IntersectsDirtyDrawArea(m_current_uv_rect);
       if (update_drawn)
       {
         GL_INS_FMT("Updating VRAM cache due to UV {} intersection with dirty DRAW {}", m_current_uv_rect,
@@ -2865,7 +3448,7 @@ ALWAYS_INLINE_RELEASE void GPU_HW::CheckForTexPageOverlap(GSVector4i uv_rect)
     if (m_texpage_dirty & TEXPAGE_DIRTY_WRITTEN_RECT)
     {
       DebugAssert(!m_vram_dirty_write_rect.eq(INVALID_RECT));
-      update_written = m_current_uv_rect.rintersects(m_vram_dirty_write_rect);
+      update_written = IntersectsDirtyWriteArea(m_current_uv_rect);
       if (update_written)
       {
         GL_INS_FMT("Updating VRAM cache due to UV {} intersection with dirty WRITE {}", m_current_uv_rect,
@@ -2877,7 +3460,7 @@ ALWAYS_INLINE_RELEASE void GPU_HW::CheckForTexPageOverlap(GSVector4i uv_rect)
     {
       if (m_batch_index_count > 0)
       {
-        FlushRender();
+        FlushBatch();
         EnsureVertexBufferSpaceForCurrentCommand();
       }
 
@@ -2920,7 +3503,7 @@ void GPU_HW::EnsureVertexBufferSpace(u32 required_vertices, u32 required_indices
     if (m_batch_vertex_space >= required_vertices && m_batch_index_space >= required_indices)
       return;
 
-    FlushRender();
+    FlushBatch();
   }
 
   MapGPUBuffer(required_vertices, required_indices);
@@ -2928,35 +3511,14 @@ void GPU_HW::EnsureVertexBufferSpace(u32 required_vertices, u32 required_indices
 
 void GPU_HW::EnsureVertexBufferSpaceForCurrentCommand()
 {
-  u32 required_vertices;
-  u32 required_indices;
-  switch (m_render_command.primitive)
-  {
-    case GPUPrimitive::Polygon:
-      required_vertices = 4; // assume quad, in case of expansion
-      required_indices = 6;
-      break;
-    case GPUPrimitive::Rectangle:
-      required_vertices = MAX_VERTICES_FOR_RECTANGLE; // TODO: WRong
-      required_indices = MAX_VERTICES_FOR_RECTANGLE;
-      break;
-    case GPUPrimitive::Line:
-    {
-      // assume expansion
-      const u32 vert_count = m_render_command.polyline ? GetPolyLineVertexCount() : 2;
-      required_vertices = vert_count * 4;
-      required_indices = vert_count * 6;
-    }
-    break;
-
-    default:
-      UnreachableCode();
-  }
+  // Requirements are set by PrepareDraw() for the command being executed.
+  const u32 required_vertices = m_current_required_vertices;
+  const u32 required_indices = m_current_required_indices;
 
   // can we fit these vertices in the current depth buffer range?
   if ((m_current_depth + required_vertices) > MAX_BATCH_VERTEX_COUNTER_IDS)
   {
-    FlushRender();
+    FlushBatch();
     ResetBatchVertexDepth();
     MapGPUBuffer(required_vertices, required_indices);
     return;
@@ -2999,6 +3561,9 @@ void GPU_HW::UpdateSoftwareRenderer(bool copy_vram_from_hw)
   if (!sw_renderer->Initialize(true))
     return;
 
+  // readbacks need the shadow copy to keep up with the hardware renderer, so split large draws across threads
+  sw_renderer->StartWorkerThreads();
+
   // We need to fill in the SW renderer's VRAM with the current state for hot toggles.
   if (copy_vram_from_hw)
   {
@@ -3041,11 +3606,31 @@ void GPU_HW::FillDrawCommand(GPUBackendDrawCommand* cmd, GPURenderCommand rc) co
   cmd->window = m_draw_mode.texture_window;
 }
 
-void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
+GPUBackendCommandParameters GPU_HW::GetHardwareCommandParameters() const
 {
-  GL_SCOPE_FMT("FillVRAM({},{} => {},{} ({}x{}) with 0x{:08X}", x, y, x + width, y + height, width, height, color);
-  DeactivateROV();
+  GPUBackendCommandParameters params;
+  params.bits = 0;
+  params.check_mask_before_draw = m_GPUSTAT.check_mask_before_draw;
+  params.set_mask_while_drawing = m_GPUSTAT.set_mask_while_drawing;
+  params.active_line_lsb = m_crtc_state.active_line_lsb;
+  params.interlaced_rendering = IsInterlacedRenderingEnabled();
+  return params;
+}
 
+void GPU_HW::FillHardwareDrawCommand(GPUBackendDrawCommand* cmd, GPURenderCommand rc)
+{
+  FillDrawCommand(cmd, rc);
+  cmd->params.interlaced_rendering = IsInterlacedRenderingEnabled();
+
+  // The backend keeps the flags until the next batch/textured draw, so they can be cleared here.
+  cmd->params.texture_page_changed = m_draw_mode.IsTexturePageChanged();
+  cmd->params.texture_window_changed = m_draw_mode.IsTextureWindowChanged();
+  m_draw_mode.ClearTexturePageChangedFlag();
+  m_draw_mode.ClearTextureWindowChangedFlag();
+}
+
+void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
+{
   if (m_sw_renderer)
   {
     GPUBackendFillVRAMCommand* cmd = m_sw_renderer->NewFillVRAMCommand();
@@ -3058,6 +3643,28 @@ void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
     m_sw_renderer->PushCommand(cmd);
   }
 
+  if (!m_backend)
+  {
+    FillVRAM(x, y, width, height, color, GetHardwareCommandParameters());
+    return;
+  }
+
+  GPUBackendFillVRAMCommand* cmd = m_backend->NewFillVRAMCommand();
+  cmd->params.bits = GetHardwareCommandParameters().bits;
+  cmd->x = static_cast<u16>(x);
+  cmd->y = static_cast<u16>(y);
+  cmd->width = static_cast<u16>(width);
+  cmd->height = static_cast<u16>(height);
+  cmd->color = color;
+  PushBackendCommand(cmd);
+}
+
+void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params)
+{
+  GL_SCOPE_FMT("FillVRAM({},{} => {},{} ({}x{}) with 0x{:08X}", x, y, x + width, y + height, width, height, color);
+  FlushVRAMWrites();
+  DeactivateROV();
+
   GL_INS_FMT("Dirty draw area before: {}", m_vram_dirty_draw_rect);
 
   const GSVector4i bounds = GetVRAMTransferBounds(x, y, width, height);
@@ -3067,7 +3674,7 @@ void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
 
   const bool is_oversized = (((x + width) > VRAM_WIDTH || (y + height) > VRAM_HEIGHT));
   g_gpu_device->SetPipeline(
-    m_vram_fill_pipelines[BoolToUInt8(is_oversized)][BoolToUInt8(IsInterlacedRenderingEnabled())].get());
+    m_vram_fill_pipelines[BoolToUInt8(is_oversized)][BoolToUInt8(params.interlaced_rendering)].get());
 
   const GSVector4i scaled_bounds = bounds.mul32l(GSVector4i(m_resolution_scale));
   g_gpu_device->SetViewportAndScissor(scaled_bounds);
@@ -3089,24 +3696,26 @@ void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
   // drop precision unless true colour is enabled
   uniforms.u_fill_color =
     GPUDevice::RGBA8ToFloat(m_true_color ? color : VRAMRGBA5551ToRGBA8888(VRAMRGBA8888ToRGBA5551(color)));
-  uniforms.u_interlaced_displayed_field = GetActiveLineLSB();
+  uniforms.u_interlaced_displayed_field = params.active_line_lsb;
   g_gpu_device->PushUniformBuffer(&uniforms, sizeof(uniforms));
   g_gpu_device->Draw(3, 0);
 
-  RestoreDeviceContext();
+  RestoreDeviceState();
 }
 
 void GPU_HW::ReadVRAM(u32 x, u32 y, u32 width, u32 height)
 {
-  GL_PUSH_FMT("ReadVRAM({},{} => {},{} ({}x{})", x, y, x + width, y + height, width, height);
-
   if (m_sw_renderer)
   {
     m_sw_renderer->Sync(false);
-    GL_POP();
     return;
   }
 
+  SyncBackend(false);
+
+  GL_PUSH_FMT("ReadVRAM({},{} => {},{} ({}x{})", x, y, x + width, y + height, width, height);
+  FlushVRAMWrites();
+
   // Get bounds with wrap-around handled.
   GSVector4i copy_rect = GetVRAMTransferBounds(x, y, width, height);
 
@@ -3151,16 +3760,14 @@ void GPU_HW::ReadVRAM(u32 x, u32 y, u32 width, u32 height)
                                                  VRAM_WIDTH * sizeof(u16));
   }
 
-  RestoreDeviceContext();
+  RestoreDeviceState();
 }
 
 void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, bool set_mask, bool check_mask)
 {
-  GL_SCOPE_FMT("UpdateVRAM({},{} => {},{} ({}x{})", x, y, x + width, y + height, width, height);
-
+  const u32 num_words = width * height;
   if (m_sw_renderer)
   {
-    const u32 num_words = width * height;
     GPUBackendUpdateVRAMCommand* cmd = m_sw_renderer->NewUpdateVRAMCommand(num_words);
     FillBackendCommandParameters(cmd);
     cmd->params.set_mask_while_drawing = set_mask;
@@ -3173,6 +3780,31 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
     m_sw_renderer->PushCommand(cmd);
   }
 
+  GPUBackendCommandParameters params = GetHardwareCommandParameters();
+  params.set_mask_while_drawing = set_mask;
+  params.check_mask_before_draw = check_mask;
+  if (!m_backend)
+  {
+    UpdateVRAM(x, y, width, height, data, params);
+    return;
+  }
+
+  GPUBackendUpdateVRAMCommand* cmd = m_backend->NewUpdateVRAMCommand(num_words);
+  cmd->params.bits = params.bits;
+  cmd->x = static_cast<u16>(x);
+  cmd->y = static_cast<u16>(y);
+  cmd->width = static_cast<u16>(width);
+  cmd->height = static_cast<u16>(height);
+  std::memcpy(cmd->data, data, sizeof(u16) * num_words);
+  PushBackendCommand(cmd);
+}
+
+void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, GPUBackendCommandParameters params)
+{
+  GL_SCOPE_FMT("UpdateVRAM({},{} => {},{} ({}x{})", x, y, x + width, y + height, width, height);
+
+  const bool set_mask = params.set_mask_while_drawing;
+  const bool check_mask = params.check_mask_before_draw;
   const GSVector4i bounds = GetVRAMTransferBounds(x, y, width, height);
   DebugAssert(bounds.right <= static_cast<s32>(VRAM_WIDTH) && bounds.bottom <= static_cast<s32>(VRAM_HEIGHT));
   AddWrittenRectangle(bounds);
@@ -3195,9 +3827,32 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
   UpdateVRAMOnGPU(x, y, width, height, data, sizeof(u16) * width, set_mask, check_mask, bounds);
 }
 
+namespace {
+struct VRAMWriteUBOData
+{
+  u32 u_dst_x;
+  u32 u_dst_y;
+  u32 u_end_x;
+  u32 u_end_y;
+  u32 u_width;
+  u32 u_height;
+  u32 u_buffer_base_offset;
+  u32 u_mask_or_bits;
+  float u_depth_value;
+};
+} // namespace
+
 void GPU_HW::UpdateVRAMOnGPU(u32 x, u32 y, u32 width, u32 height, const void* data, u32 data_pitch, bool set_mask,
                              bool check_mask, const GSVector4i bounds)
 {
+  // small uploads get batched together, saving the map/draw/state restore for each one
+  if (m_vram_upload_buffer && (width * height) <= MAX_PENDING_VRAM_WRITE_PIXELS)
+  {
+    QueueVRAMWrite(x, y, width, height, data, data_pitch, set_mask, check_mask, bounds);
+    return;
+  }
+
+  FlushVRAMWrites();
   DeactivateROV();
 
   std::unique_ptr<GPUTexture> upload_texture;
@@ -3224,18 +3879,6 @@ void GPU_HW::UpdateVRAMOnGPU(u32 x, u32 y, u32 width, u32 height, const void* da
     m_vram_upload_buffer->Unmap(num_pixels);
   }
 
-  struct VRAMWriteUBOData
-  {
-    u32 u_dst_x;
-    u32 u_dst_y;
-    u32 u_end_x;
-    u32 u_end_y;
-    u32 u_width;
-    u32 u_height;
-    u32 u_buffer_base_offset;
-    u32 u_mask_or_bits;
-    float u_depth_value;
-  };
   const VRAMWriteUBOData uniforms = {
     (x % VRAM_WIDTH), (y % VRAM_HEIGHT), ((x + width) % VRAM_WIDTH),  ((y + height) % VRAM_HEIGHT),     width,
     height,           map_index,         (set_mask) ? 0x8000u : 0x00, GetCurrentNormalizedVertexDepth()};
@@ -3257,13 +3900,87 @@ void GPU_HW::UpdateVRAMOnGPU(u32 x, u32 y, u32 width, u32 height, const void* da
     g_gpu_device->Draw(3, 0);
   }
 
-  RestoreDeviceContext();
+  RestoreDeviceState();
 }
 
-void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height)
+void GPU_HW::QueueVRAMWrite(u32 x, u32 y, u32 width, u32 height, const void* data, u32 data_pitch, bool set_mask,
+                            bool check_mask, const GSVector4i bounds)
 {
-  GL_SCOPE_FMT("CopyVRAM({}x{} @ {},{} => {},{}", width, height, src_x, src_y, dst_x, dst_y);
+  const u32 num_pixels = width * height;
+  if (m_num_pending_vram_writes == MAX_PENDING_VRAM_WRITES ||
+      (m_vram_write_staging_used + num_pixels) > VRAM_WRITE_STAGING_PIXELS)
+  {
+    FlushVRAMWrites();
+  }
+
+  PendingVRAMWrite& write = m_pending_vram_writes[m_num_pending_vram_writes++];
+  write.bounds = bounds;
+  write.x = static_cast<u16>(x);
+  write.y = static_cast<u16>(y);
+  write.width = static_cast<u16>(width);
+  write.height = static_cast<u16>(height);
+  write.staging_offset = m_vram_write_staging_used;
+  write.depth_value = GetCurrentNormalizedVertexDepth();
+  write.set_mask = set_mask;
+  write.depth_test = (check_mask && m_write_mask_as_depth);
+
+  const u32 dst_pitch = width * sizeof(u16);
+  StringUtil::StrideMemCpy(&m_vram_write_staging[m_vram_write_staging_used], dst_pitch, data, data_pitch, dst_pitch,
+                           height);
+  m_vram_write_staging_used += num_pixels;
+}
+
+void GPU_HW::FlushVRAMWrites()
+{
+  if (m_num_pending_vram_writes == 0)
+    return;
+
+  GL_SCOPE_FMT("FlushVRAMWrites({} writes, {} pixels)", m_num_pending_vram_writes, m_vram_write_staging_used);
+  DeactivateROV();
+
+  // all writes share a single upload
+  void* map = m_vram_upload_buffer->Map(m_vram_write_staging_used);
+  const u32 map_index = m_vram_upload_buffer->GetCurrentPosition();
+  std::memcpy(map, m_vram_write_staging.data(), m_vram_write_staging_used * sizeof(u16));
+  m_vram_upload_buffer->Unmap(m_vram_write_staging_used);
+
+  // the viewport should already be set to the full vram, so just adjust the scissor
+  GPUPipeline* current_pipeline = nullptr;
+  for (u32 i = 0; i < m_num_pending_vram_writes; i++)
+  {
+    const PendingVRAMWrite& write = m_pending_vram_writes[i];
+    GPUPipeline* pipeline = m_vram_write_pipelines[BoolToUInt8(write.depth_test)].get();
+    if (pipeline != current_pipeline)
+    {
+      g_gpu_device->SetPipeline(pipeline);
+      g_gpu_device->SetTextureBuffer(0, m_vram_upload_buffer.get());
+      current_pipeline = pipeline;
+    }
+
+    const VRAMWriteUBOData uniforms = {(write.x % VRAM_WIDTH),
+                                       (write.y % VRAM_HEIGHT),
+                                       ((write.x + write.width) % VRAM_WIDTH),
+                                       ((write.y + write.height) % VRAM_HEIGHT),
+                                       write.width,
+                                       write.height,
+                                       map_index + write.staging_offset,
+                                       write.set_mask ? 0x8000u : 0x00,
+                                       write.depth_value};
+
+    const GSVector4i scaled_bounds = write.bounds.mul32l(GSVector4i(m_resolution_scale));
+    g_gpu_device->SetScissor(scaled_bounds.left, scaled_bounds.top, scaled_bounds.width(), scaled_bounds.height());
+    g_gpu_device->PushUniformBuffer(&uniforms, sizeof(uniforms));
+    g_gpu_device->Draw(3, 0);
+  }
 
+  m_num_pending_vram_writes = 0;
+  m_vram_write_staging_used = 0;
+
+  RestoreDeviceState();
+}
+
+void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height)
+{
   if (m_sw_renderer)
   {
     GPUBackendCopyVRAMCommand* cmd = m_sw_renderer->NewCopyVRAMCommand();
@@ -3277,15 +3994,38 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
     m_sw_renderer->PushCommand(cmd);
   }
 
+  if (!m_backend)
+  {
+    CopyVRAM(src_x, src_y, dst_x, dst_y, width, height, GetHardwareCommandParameters());
+    return;
+  }
+
+  GPUBackendCopyVRAMCommand* cmd = m_backend->NewCopyVRAMCommand();
+  cmd->params.bits = GetHardwareCommandParameters().bits;
+  cmd->src_x = static_cast<u16>(src_x);
+  cmd->src_y = static_cast<u16>(src_y);
+  cmd->dst_x = static_cast<u16>(dst_x);
+  cmd->dst_y = static_cast<u16>(dst_y);
+  cmd->width = static_cast<u16>(width);
+  cmd->height = static_cast<u16>(height);
+  PushBackendCommand(cmd);
+}
+
+void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height,
+                      GPUBackendCommandParameters params)
+{
+  GL_SCOPE_FMT("CopyVRAM({}x{} @ {},{} => {},{}", width, height, src_x, src_y, dst_x, dst_y);
+  FlushVRAMWrites();
+
   // masking enabled, oversized, or overlapping
   const bool use_shader =
-    (m_GPUSTAT.IsMaskingEnabled() || ((src_x % VRAM_WIDTH) + width) > VRAM_WIDTH ||
+    (params.IsMaskingEnabled() || ((src_x % VRAM_WIDTH) + width) > VRAM_WIDTH ||
      ((src_y % VRAM_HEIGHT) + height) > VRAM_HEIGHT || ((dst_x % VRAM_WIDTH) + width) > VRAM_WIDTH ||
      ((dst_y % VRAM_HEIGHT) + height) > VRAM_HEIGHT);
   const GSVector4i src_bounds = GetVRAMTransferBounds(src_x, src_y, width, height);
   const GSVector4i dst_bounds = GetVRAMTransferBounds(dst_x, dst_y, width, height);
-  const bool intersect_with_draw = m_vram_dirty_draw_rect.rintersects(src_bounds);
-  const bool intersect_with_write = m_vram_dirty_write_rect.rintersects(src_bounds);
+  const bool intersect_with_draw = IntersectsDirtyDrawArea(src_bounds);
+  const bool intersect_with_write = IntersectsDirtyWriteArea(src_bounds);
 
   if (use_shader || IsUsingMultisampling())
   {
@@ -3316,19 +4056,19 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
                                       ((dst_y + height) % VRAM_HEIGHT) * m_resolution_scale,
                                       width * m_resolution_scale,
                                       height * m_resolution_scale,
-                                      m_GPUSTAT.set_mask_while_drawing ? 1u : 0u,
+                                      params.set_mask_while_drawing ? 1u : 0u,
                                       GetCurrentNormalizedVertexDepth()};
 
     // VRAM read texture should already be bound.
     const GSVector4i dst_bounds_scaled = dst_bounds.mul32l(GSVector4i(m_resolution_scale));
     g_gpu_device->SetViewportAndScissor(dst_bounds_scaled);
     g_gpu_device->SetPipeline(
-      m_vram_copy_pipelines[BoolToUInt8(m_GPUSTAT.check_mask_before_draw && m_write_mask_as_depth)].get());
+      m_vram_copy_pipelines[BoolToUInt8(params.check_mask_before_draw && m_write_mask_as_depth)].get());
     g_gpu_device->PushUniformBuffer(&uniforms, sizeof(uniforms));
     g_gpu_device->Draw(3, 0);
-    RestoreDeviceContext();
+    RestoreDeviceState();
 
-    if (m_GPUSTAT.check_mask_before_draw && !m_pgxp_depth_buffer)
+    if (params.check_mask_before_draw && !m_pgxp_depth_buffer)
       m_current_depth++;
 
     return;
@@ -3362,7 +4102,7 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
       AddUnclampedDrawnRectangle(dst_bounds);
   }
 
-  if (m_GPUSTAT.check_mask_before_draw)
+  if (params.check_mask_before_draw)
   {
     // set new vertex counter since we want this to take into consideration previous masked pixels
     m_current_depth++;
@@ -3377,6 +4117,14 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
 
 void GPU_HW::DispatchRenderCommand()
 {
+  if (m_backend)
+  {
+    QueueRenderCommand();
+    return;
+  }
+
+  FlushVRAMWrites();
+
   const GPURenderCommand rc{m_render_command.bits};
 
   BatchTextureMode texture_mode = BatchTextureMode::Disabled;
@@ -3400,13 +4148,13 @@ void GPU_HW::DispatchRenderCommand()
       if (m_draw_mode.mode_reg.IsUsingPalette())
       {
         const GSVector4i palette_rect = m_draw_mode.palette_reg.GetRectangle(m_draw_mode.mode_reg.texture_mode);
-        const bool update_drawn = palette_rect.rintersects(m_vram_dirty_draw_rect);
-        const bool update_written = palette_rect.rintersects(m_vram_dirty_write_rect);
+        const bool update_drawn = IntersectsDirtyDrawArea(palette_rect);
+        const bool update_written = IntersectsDirtyWriteArea(palette_rect);
         if (update_drawn || update_written)
         {
           GL_INS("Palette in VRAM dirty area, flushing cache");
           if (!IsFlushed())
-            FlushRender();
+            FlushBatch();
 
           UpdateVRAMReadTexture(update_drawn, update_written);
         }
@@ -3415,8 +4163,8 @@ void GPU_HW::DispatchRenderCommand()
       const GSVector4i page_rect = m_draw_mode.mode_reg.GetTexturePageRectangle();
       GSVector4i::storel(m_current_texture_page_offset, page_rect);
 
-      u8 new_texpage_dirty = m_vram_dirty_draw_rect.rintersects(page_rect) ? TEXPAGE_DIRTY_DRAWN_RECT : 0;
-      new_texpage_dirty |= m_vram_dirty_write_rect.rintersects(page_rect) ? TEXPAGE_DIRTY_WRITTEN_RECT : 0;
+      u8 new_texpage_dirty = IntersectsDirtyDrawArea(page_rect) ? TEXPAGE_DIRTY_DRAWN_RECT : 0;
+      new_texpage_dirty |= IntersectsDirtyWriteArea(page_rect) ? TEXPAGE_DIRTY_WRITTEN_RECT : 0;
 
       if (new_texpage_dirty != 0)
       {
@@ -3449,12 +4197,34 @@ void GPU_HW::DispatchRenderCommand()
       (transparency_mode == GPUTransparencyMode::BackgroundMinusForeground && !m_allow_shader_blend) ||
       dithering_enable != m_batch.dithering)
   {
-    FlushRender();
+    SplitBatch();
   }
 
+  switch (rc.primitive)
+  {
+    case GPUPrimitive::Polygon:
+      m_current_required_vertices = 4; // assume quad, in case of expansion
+      m_current_required_indices = 6;
+      break;
+    case GPUPrimitive::Rectangle:
+      m_current_required_vertices = MAX_VERTICES_FOR_RECTANGLE;
+      m_current_required_indices = MAX_VERTICES_FOR_RECTANGLE;
+      break;
+    case GPUPrimitive::Line:
+    {
+      // assume expansion
+      const u32 vert_count = rc.polyline ? GetPolyLineVertexCount() : 2;
+      m_current_required_vertices = vert_count * 4;
+      m_current_required_indices = vert_count * 6;
+    }
+    break;
+
+    default:
+      UnreachableCode();
+  }
   EnsureVertexBufferSpaceForCurrentCommand();
 
-  if (m_batch_index_count == 0)
+  if (m_batch_index_count == m_batch_split_start_index)
   {
     // transparency mode change
     const bool check_mask_before_draw = m_GPUSTAT.check_mask_before_draw;
@@ -3510,13 +4280,15 @@ void GPU_HW::DispatchRenderCommand()
 
     if (m_drawing_area_changed)
     {
+      // Drawing area changes flush, so there shouldn't be any splits using the old scissor.
+      DebugAssert(m_num_batch_splits == 0);
       m_drawing_area_changed = false;
       SetClampedDrawingArea();
       SetScissor();
 
       if (m_pgxp_depth_buffer && m_last_depth_z < 1.0f)
       {
-        FlushRender();
+        FlushBatch();
         CopyAndClearDepthBuffer();
         EnsureVertexBufferSpaceForCurrentCommand();
       }
@@ -3533,6 +4305,438 @@ void GPU_HW::DispatchRenderCommand()
   LoadVertices();
 }
 
+void GPU_HW::QueueRenderCommand()
+{
+  if (m_drawing_area_changed)
+  {
+    GPUBackendSetDrawingAreaCommand* cmd = m_backend->NewSetDrawingAreaCommand();
+    cmd->new_area = m_drawing_area;
+    GSVector4i::store<false>(cmd->new_clamped_area, m_clamped_drawing_area);
+    PushBackendCommand(cmd);
+
+    if (m_sw_renderer)
+    {
+      GPUBackendSetDrawingAreaCommand* sw_cmd = m_sw_renderer->NewSetDrawingAreaCommand();
+      sw_cmd->new_area = m_drawing_area;
+      m_sw_renderer->PushCommand(sw_cmd);
+    }
+
+    m_drawing_area_changed = false;
+  }
+
+  const GPURenderCommand rc{m_render_command.bits};
+
+  switch (rc.primitive)
+  {
+    case GPUPrimitive::Polygon:
+    {
+      const bool textured = rc.texture_enable;
+      const bool raw_texture = textured && rc.raw_texture_enable;
+      const bool shaded = rc.shading_enable;
+      const bool pgxp = g_settings.gpu_pgxp_enable;
+
+      const u32 first_color = rc.color_for_first_vertex;
+      const u32 num_vertices = rc.quad_polygon ? 4 : 3;
+      GPUBackendDrawPrecisePolygonCommand* cmd = m_backend->NewDrawPrecisePolygonCommand(num_vertices);
+      FillHardwareDrawCommand(cmd, rc);
+      cmd->pgxp = pgxp;
+
+      std::array<GSVector2i, 4> native_vertex_positions;
+      std::array<u16, 4> native_texcoords;
+      bool valid_w = g_settings.gpu_pgxp_texture_correction;
+      for (u32 i = 0; i < num_vertices; i++)
+      {
+        GPUBackendDrawPrecisePolygonCommand::Vertex& vert = cmd->vertices[i];
+        const u32 vert_color = (shaded && i > 0) ? (FifoPop() & UINT32_C(0x00FFFFFF)) : first_color;
+        vert.color = raw_texture ? UINT32_C(0x00808080) : vert_color;
+        const u64 maddr_and_pos = m_fifo.Pop();
+        const GPUVertexPosition vp{Truncate32(maddr_and_pos)};
+        vert.texcoord = native_texcoords[i] = textured ? Truncate16(FifoPop()) : 0;
+        const s32 native_x = native_vertex_positions[i].x = m_drawing_offset.x + vp.x;
+        const s32 native_y = native_vertex_positions[i].y = m_drawing_offset.y + vp.y;
+        vert.x = static_cast<float>(native_x);
+        vert.y = static_cast<float>(native_y);
+        vert.w = 1.0f;
+
+        if (pgxp)
+        {
+          valid_w &= CPU::PGXP::GetPreciseVertex(Truncate32(maddr_and_pos >> 32), vp.bits, native_x, native_y,
+                                                 m_drawing_offset.x, m_drawing_offset.y, &vert.x, &vert.y, &vert.w);
+        }
+      }
+      if (pgxp && !valid_w)
+      {
+        const bool disable_2d = g_settings.gpu_pgxp_disable_2d;
+        for (u32 i = 0; i < num_vertices; i++)
+        {
+          GPUBackendDrawPrecisePolygonCommand::Vertex& vert = cmd->vertices[i];
+          if (disable_2d)
+          {
+            vert.x = static_cast<float>(native_vertex_positions[i].x);
+            vert.y = static_cast<float>(native_vertex_positions[i].y);
+          }
+          vert.w = 1.0f;
+        }
+      }
+      cmd->valid_w = valid_w;
+
+      if (m_sw_renderer)
+      {
+        GPUBackendDrawPolygonCommand* sw_cmd = m_sw_renderer->NewDrawPolygonCommand(num_vertices);
+        FillDrawCommand(sw_cmd, rc);
+
+        for (u32 i = 0; i < num_vertices; i++)
+        {
+          GPUBackendDrawPolygonCommand::Vertex* vert = &sw_cmd->vertices[i];
+          vert->x = native_vertex_positions[i].x;
+          vert->y = native_vertex_positions[i].y;
+          vert->texcoord = native_texcoords[i];
+          vert->color = cmd->vertices[i].color;
+        }
+
+        m_sw_renderer->PushCommand(sw_cmd);
+      }
+
+      AddDrawPolygonTicks(rc, native_vertex_positions.data());
+
+      PushBackendCommand(cmd);
+    }
+    break;
+
+    case GPUPrimitive::Rectangle:
+    {
+      const u32 color = (rc.texture_enable && rc.raw_texture_enable) ? UINT32_C(0x00808080) : rc.color_for_first_vertex;
+      const GPUVertexPosition vp{FifoPop()};
+      const s32 pos_x = TruncateGPUVertexPosition(m_drawing_offset.x + vp.x);
+      const s32 pos_y = TruncateGPUVertexPosition(m_drawing_offset.y + vp.y);
+      const u16 texcoord = rc.texture_enable ? Truncate16(FifoPop()) : 0;
+
+      u32 rectangle_width;
+      u32 rectangle_height;
+      switch (rc.rectangle_size)
+      {
+        case GPUDrawRectangleSize::R1x1:
+          rectangle_width = 1;
+          rectangle_height = 1;
+          break;
+        case GPUDrawRectangleSize::R8x8:
+          rectangle_width = 8;
+          rectangle_height = 8;
+          break;
+        case GPUDrawRectangleSize::R16x16:
+          rectangle_width = 16;
+          rectangle_height = 16;
+          break;
+        default:
+        {
+          const u32 width_and_height = FifoPop();
+          rectangle_width = (width_and_height & VRAM_WIDTH_MASK);
+          rectangle_height = ((width_and_height >> 16) & VRAM_HEIGHT_MASK);
+        }
+        break;
+      }
+
+      const GSVector4i rect =
+        GSVector4i(pos_x, pos_y, pos_x + static_cast<s32>(rectangle_width), pos_y + static_cast<s32>(rectangle_height));
+      const GSVector4i clamped_rect = m_clamped_drawing_area.rintersect(rect);
+      if (clamped_rect.rempty()) [[unlikely]]
+      {
+        GL_INS_FMT("Culling off-screen rectangle {}", rect);
+        return;
+      }
+
+      AddDrawRectangleTicks(clamped_rect, rc.texture_enable, rc.transparency_enable);
+
+      GPUBackendDrawRectangleCommand* cmd = m_backend->NewDrawRectangleCommand();
+      FillHardwareDrawCommand(cmd, rc);
+      cmd->color = color;
+      cmd->x = pos_x;
+      cmd->y = pos_y;
+      cmd->width = static_cast<u16>(rectangle_width);
+      cmd->height = static_cast<u16>(rectangle_height);
+      cmd->texcoord = texcoord;
+      PushBackendCommand(cmd);
+
+      if (m_sw_renderer)
+      {
+        GPUBackendDrawRectangleCommand* sw_cmd = m_sw_renderer->NewDrawRectangleCommand();
+        FillDrawCommand(sw_cmd, rc);
+        sw_cmd->color = color;
+        sw_cmd->x = pos_x;
+        sw_cmd->y = pos_y;
+        sw_cmd->width = static_cast<u16>(rectangle_width);
+        sw_cmd->height = static_cast<u16>(rectangle_height);
+        sw_cmd->texcoord = texcoord;
+        m_sw_renderer->PushCommand(sw_cmd);
+      }
+    }
+    break;
+
+    case GPUPrimitive::Line:
+    {
+      if (!rc.polyline)
+      {
+        u32 start_color, end_color;
+        GPUVertexPosition start_pos, end_pos;
+        if (rc.shading_enable)
+        {
+          start_color = rc.color_for_first_vertex;
+          start_pos.bits = FifoPop();
+          end_color = FifoPop() & UINT32_C(0x00FFFFFF);
+          end_pos.bits = FifoPop();
+        }
+        else
+        {
+          start_color = end_color = rc.color_for_first_vertex;
+          start_pos.bits = FifoPop();
+          end_pos.bits = FifoPop();
+        }
+
+        const GSVector4i vstart_pos = GSVector4i(start_pos.x + m_drawing_offset.x, start_pos.y + m_drawing_offset.y);
+        const GSVector4i vend_pos = GSVector4i(end_pos.x + m_drawing_offset.x, end_pos.y + m_drawing_offset.y);
+        const GSVector4i bounds = vstart_pos.xyxy(vend_pos);
+        const GSVector4i rect =
+          vstart_pos.min_i32(vend_pos).xyxy(vstart_pos.max_i32(vend_pos)).add32(GSVector4i::cxpr(0, 0, 1, 1));
+        const GSVector4i clamped_rect = rect.rintersect(m_clamped_drawing_area);
+
+        if (rect.width() > MAX_PRIMITIVE_WIDTH || rect.height() > MAX_PRIMITIVE_HEIGHT || clamped_rect.rempty())
+        {
+          GL_INS_FMT("Culling too-large/off-screen line: {},{} - {},{}", bounds.x, bounds.y, bounds.z, bounds.w);
+          return;
+        }
+
+        AddDrawLineTicks(clamped_rect, rc.shading_enable);
+
+        GPUBackendDrawLineCommand* cmd = m_backend->NewDrawLineCommand(2);
+        FillHardwareDrawCommand(cmd, rc);
+        GSVector4i::storel(&cmd->vertices[0], bounds);
+        cmd->vertices[0].color = start_color;
+        GSVector4i::storeh(&cmd->vertices[1], bounds);
+        cmd->vertices[1].color = end_color;
+        PushBackendCommand(cmd);
+
+        if (m_sw_renderer)
+        {
+          GPUBackendDrawLineCommand* sw_cmd = m_sw_renderer->NewDrawLineCommand(2);
+          FillDrawCommand(sw_cmd, rc);
+          GSVector4i::storel(&sw_cmd->vertices[0], bounds);
+          sw_cmd->vertices[0].color = start_color;
+          GSVector4i::storeh(&sw_cmd->vertices[1], bounds);
+          sw_cmd->vertices[1].color = end_color;
+          m_sw_renderer->PushCommand(sw_cmd);
+        }
+      }
+      else
+      {
+        const u32 num_vertices = GetPolyLineVertexCount();
+        const bool shaded = rc.shading_enable;
+
+        GPUBackendDrawLineCommand* cmd = m_backend->NewDrawLineCommand(num_vertices);
+        FillHardwareDrawCommand(cmd, rc);
+
+        u32 buffer_pos = 0;
+        const GPUVertexPosition start_vp{m_blit_buffer[buffer_pos++]};
+        GSVector4i start_pos = GSVector4i(start_vp.x + m_drawing_offset.x, start_vp.y + m_drawing_offset.y);
+        u32 start_color = rc.color_for_first_vertex;
+        GSVector4i::storel(&cmd->vertices[0].x, start_pos);
+        cmd->vertices[0].color = start_color;
+
+        for (u32 i = 1; i < num_vertices; i++)
+        {
+          const u32 end_color = shaded ? (m_blit_buffer[buffer_pos++] & UINT32_C(0x00FFFFFF)) : start_color;
+          const GPUVertexPosition vp{m_blit_buffer[buffer_pos++]};
+          const GSVector4i end_pos = GSVector4i(m_drawing_offset.x + vp.x, m_drawing_offset.y + vp.y);
+          const GSVector4i rect =
+            start_pos.min_i32(end_pos).xyxy(start_pos.max_i32(end_pos)).add32(GSVector4i::cxpr(0, 0, 1, 1));
+          const GSVector4i clamped_rect = rect.rintersect(m_clamped_drawing_area);
+          if (rect.width() <= MAX_PRIMITIVE_WIDTH && rect.height() <= MAX_PRIMITIVE_HEIGHT && !clamped_rect.rempty())
+            AddDrawLineTicks(clamped_rect, rc.shading_enable);
+
+          GSVector4i::storel(&cmd->vertices[i], end_pos);
+          cmd->vertices[i].color = end_color;
+          start_pos = end_pos;
+          start_color = end_color;
+        }
+
+        if (m_sw_renderer)
+        {
+          GPUBackendDrawLineCommand* sw_cmd = m_sw_renderer->NewDrawLineCommand(num_vertices);
+          FillDrawCommand(sw_cmd, rc);
+          std::memcpy(sw_cmd->vertices, cmd->vertices, sizeof(GPUBackendDrawLineCommand::Vertex) * num_vertices);
+          m_sw_renderer->PushCommand(sw_cmd);
+        }
+
+        PushBackendCommand(cmd);
+      }
+    }
+    break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
+void GPU_HW::DrawingAreaChanged(const GSVector4i clamped_drawing_area)
+{
+  // Drawing area changes flush, so there shouldn't be any splits using the old scissor.
+  DebugAssert(m_num_batch_splits == 0);
+  m_backend_drawing_area = clamped_drawing_area;
+  SetScissor();
+
+  if (m_pgxp_depth_buffer && m_last_depth_z < 1.0f)
+  {
+    FlushVRAMWrites();
+    CopyAndClearDepthBuffer();
+  }
+}
+
+void GPU_HW::PrepareDraw(const GPUBackendDrawCommand* cmd, u32 required_vertices, u32 required_indices)
+{
+  FlushVRAMWrites();
+
+  m_backend_draw_mode.bits = cmd->draw_mode.bits;
+  m_backend_palette_reg.bits = cmd->palette.bits;
+  if (cmd->params.texture_page_changed)
+    m_backend_texture_page_changed = true;
+  if (cmd->params.texture_window_changed)
+    m_backend_texture_window_changed = true;
+
+  const GPURenderCommand rc{cmd->rc.bits};
+
+  BatchTextureMode texture_mode = BatchTextureMode::Disabled;
+  if (rc.IsTexturingEnabled())
+  {
+    // texture page changed - check that the new page doesn't intersect the drawing area
+    if (m_backend_texture_page_changed)
+    {
+      m_backend_texture_page_changed = false;
+
+#if 0
+      if (!m_vram_dirty_draw_rect.eq(INVALID_RECT) || !m_vram_dirty_write_rect.eq(INVALID_RECT))
+      {
+        GL_INS_FMT("VRAM DIRTY: {} {}", m_vram_dirty_draw_rect, m_vram_dirty_write_rect);
+        GL_INS_FMT("PAGE RECT: {}", m_backend_draw_mode.GetTexturePageRectangle());
+        if (m_backend_draw_mode.IsUsingPalette())
+          GL_INS_FMT("PALETTE RECT: {}", m_backend_palette_reg.GetRectangle(m_backend_draw_mode.texture_mode));
+      }
+#endif
+
+      if (m_backend_draw_mode.IsUsingPalette())
+      {
+        const GSVector4i palette_rect = m_backend_palette_reg.GetRectangle(m_backend_draw_mode.texture_mode);
+        const bool update_drawn = IntersectsDirtyDrawArea(palette_rect);
+        const bool update_written = IntersectsDirtyWriteArea(palette_rect);
+        if (update_drawn || update_written)
+        {
+          GL_INS("Palette in VRAM dirty area, flushing cache");
+          if (!IsFlushed())
+            FlushBatch();
+
+          UpdateVRAMReadTexture(update_drawn, update_written);
+        }
+      }
+
+      const GSVector4i page_rect = m_backend_draw_mode.GetTexturePageRectangle();
+      GSVector4i::storel(m_current_texture_page_offset, page_rect);
+
+      u8 new_texpage_dirty = IntersectsDirtyDrawArea(page_rect) ? TEXPAGE_DIRTY_DRAWN_RECT : 0;
+      new_texpage_dirty |= IntersectsDirtyWriteArea(page_rect) ? TEXPAGE_DIRTY_WRITTEN_RECT : 0;
+
+      if (new_texpage_dirty != 0)
+      {
+        GL_INS("Texpage is in dirty area, checking UV ranges");
+        m_texpage_dirty = new_texpage_dirty;
+        m_compute_uv_range = true;
+        m_current_uv_rect = INVALID_RECT;
+      }
+      else
+      {
+        m_compute_uv_range = m_clamp_uvs;
+        if (m_texpage_dirty)
+          GL_INS("Texpage is no longer dirty");
+        m_texpage_dirty = 0;
+      }
+    }
+
+    texture_mode = (m_backend_draw_mode.texture_mode == GPUTextureMode::Reserved_Direct16Bit) ?
+                     BatchTextureMode::Direct16Bit :
+                     static_cast<BatchTextureMode>(m_backend_draw_mode.texture_mode.GetValue());
+  }
+
+  // has any state changed which requires a new batch?
+  // Reverse blending breaks with mixed transparent and opaque pixels, so we have to do one draw per polygon.
+  // If we have fbfetch, we don't need to draw it in two passes. Test case: Suikoden 2 shadows.
+  const GPUTransparencyMode transparency_mode =
+    rc.transparency_enable ? m_backend_draw_mode.transparency_mode : GPUTransparencyMode::Disabled;
+  const bool dithering_enable = (!m_true_color && cmd->IsDitheringEnabled());
+  if (texture_mode != m_batch.texture_mode || transparency_mode != m_batch.transparency_mode ||
+      (transparency_mode == GPUTransparencyMode::BackgroundMinusForeground && !m_allow_shader_blend) ||
+      dithering_enable != m_batch.dithering)
+  {
+    SplitBatch();
+  }
+
+  m_current_required_vertices = required_vertices;
+  m_current_required_indices = required_indices;
+  EnsureVertexBufferSpaceForCurrentCommand();
+
+  if (m_batch_index_count == m_batch_split_start_index)
+  {
+    // transparency mode change
+    const bool check_mask_before_draw = cmd->params.check_mask_before_draw;
+    if (transparency_mode != GPUTransparencyMode::Disabled && !m_rov_active && !m_prefer_shader_blend &&
+        !NeedsShaderBlending(transparency_mode, texture_mode, check_mask_before_draw))
+    {
+      static constexpr float transparent_alpha[4][2] = {{0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 1.0f}, {0.25f, 1.0f}};
+
+      const float src_alpha_factor = transparent_alpha[static_cast<u32>(transparency_mode)][0];
+      const float dst_alpha_factor = transparent_alpha[static_cast<u32>(transparency_mode)][1];
+      m_batch_ubo_dirty |= (m_batch_ubo_data.u_src_alpha_factor != src_alpha_factor ||
+                            m_batch_ubo_data.u_dst_alpha_factor != dst_alpha_factor);
+      m_batch_ubo_data.u_src_alpha_factor = src_alpha_factor;
+      m_batch_ubo_data.u_dst_alpha_factor = dst_alpha_factor;
+    }
+
+    const bool set_mask_while_drawing = cmd->params.set_mask_while_drawing;
+    if (m_batch.check_mask_before_draw != check_mask_before_draw ||
+        m_batch.set_mask_while_drawing != set_mask_while_drawing)
+    {
+      m_batch.check_mask_before_draw = check_mask_before_draw;
+      m_batch.set_mask_while_drawing = set_mask_while_drawing;
+      m_batch_ubo_dirty |= (m_batch_ubo_data.u_set_mask_while_drawing != BoolToUInt32(set_mask_while_drawing));
+      m_batch_ubo_data.u_set_mask_while_drawing = BoolToUInt32(set_mask_while_drawing);
+    }
+
+    m_batch.interlacing = cmd->params.interlaced_rendering;
+    if (m_batch.interlacing)
+    {
+      const u32 displayed_field = cmd->params.active_line_lsb;
+      m_batch_ubo_dirty |= (m_batch_ubo_data.u_interlaced_displayed_field != displayed_field);
+      m_batch_ubo_data.u_interlaced_displayed_field = displayed_field;
+    }
+
+    // update state
+    m_batch.texture_mode = texture_mode;
+    m_batch.transparency_mode = transparency_mode;
+    m_batch.dithering = dithering_enable;
+
+    if (m_backend_texture_window_changed)
+    {
+      m_backend_texture_window_changed = false;
+
+      m_batch_ubo_data.u_texture_window[0] = ZeroExtend32(cmd->window.and_x);
+      m_batch_ubo_data.u_texture_window[1] = ZeroExtend32(cmd->window.and_y);
+      m_batch_ubo_data.u_texture_window[2] = ZeroExtend32(cmd->window.or_x);
+      m_batch_ubo_data.u_texture_window[3] = ZeroExtend32(cmd->window.or_y);
+
+      m_texture_window_active = ((cmd->window.and_x & cmd->window.and_y) != 0xFF ||
+                                 ((cmd->window.or_x | cmd->window.or_y) != 0));
+      m_batch_ubo_dirty = true;
+    }
+  }
+}
+
 void GPU_HW::UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit)
 {
   // Not done in HW, but need to forward through to SW if using that for readbacks
@@ -3546,23 +4750,78 @@ void GPU_HW::UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit)
   }
 }
 
+void GPU_HW::SplitBatch()
+{
+  const u32 index_count = m_batch_index_count - m_batch_split_start_index;
+  if (index_count == 0)
+    return;
+
+  if (m_num_batch_splits == MAX_BATCH_SPLITS) [[unlikely]]
+  {
+    FlushBatch();
+    return;
+  }
+
+  BatchSplit& split = m_batch_splits[m_num_batch_splits++];
+  split.config = m_batch;
+  split.ubo_data = m_batch_ubo_data;
+  split.start_index = m_batch_split_start_index;
+  split.index_count = Truncate16(index_count);
+  split.ubo_dirty = m_batch_ubo_dirty;
+
+  // Uniforms will be uploaded with the split, so further changes are relative to it.
+  m_batch_ubo_dirty = false;
+  m_batch_split_start_index = m_batch_index_count;
+}
+
 void GPU_HW::FlushRender()
+{
+  if (!m_backend)
+  {
+    FlushBatch();
+    return;
+  }
+
+  // Nothing can have been batched since the last sync if no commands were queued.
+  if (m_backend_commands_queued)
+    m_backend->PushCommand(m_backend->NewFlushRenderCommand());
+}
+
+void GPU_HW::FlushBatch()
 {
   const u32 base_vertex = m_batch_base_vertex;
   const u32 base_index = m_batch_base_index;
   const u32 index_count = m_batch_index_count;
+  const u32 split_start_index = m_batch_split_start_index;
   DebugAssert((m_batch_vertex_ptr != nullptr) == (m_batch_index_ptr != nullptr));
   if (m_batch_vertex_ptr)
     UnmapGPUBuffer(m_batch_vertex_count, index_count);
   if (index_count == 0)
     return;
 
-#ifdef _DEBUG
-  GL_SCOPE_FMT("Hardware Draw {}", ++s_draw_number);
-#endif
-
   GL_INS_FMT("Dirty draw area: {}", m_vram_dirty_draw_rect);
 
+  // Draw any batches which were split off while the buffer was mapped, restoring the current state afterwards.
+  if (m_num_batch_splits > 0)
+  {
+    const BatchConfig current_config = m_batch;
+    for (u32 i = 0; i < m_num_batch_splits; i++)
+    {
+      const BatchSplit& split = m_batch_splits[i];
+      if (split.ubo_dirty)
+        g_gpu_device->UploadUniformBuffer(&split.ubo_data, sizeof(split.ubo_data));
+
+      m_batch = split.config;
+      DrawBatch(split.index_count, base_index + split.start_index, base_vertex);
+    }
+
+    m_batch = current_config;
+    m_num_batch_splits = 0;
+  }
+
+  if (index_count == split_start_index)
+    return;
+
   if (m_batch_ubo_dirty)
   {
     g_gpu_device->UploadUniformBuffer(&m_batch_ubo_data, sizeof(m_batch_ubo_data));
@@ -3570,6 +4829,15 @@ void GPU_HW::FlushRender()
     m_batch_ubo_dirty = false;
   }
 
+  DrawBatch(index_count - split_start_index, base_index + split_start_index, base_vertex);
+}
+
+void GPU_HW::DrawBatch(u32 index_count, u32 base_index, u32 base_vertex)
+{
+#ifdef _DEBUG
+  GL_SCOPE_FMT("Hardware Draw {}", ++s_draw_number);
+#endif
+
   if (m_wireframe_mode != GPUWireframeMode::OnlyWireframe)
   {
     if (NeedsShaderBlending(m_batch.transparency_mode, m_batch.texture_mode, m_batch.check_mask_before_draw) ||
@@ -3599,7 +4867,8 @@ void GPU_HW::FlushRender()
 
 void GPU_HW::UpdateDisplay()
 {
-  FlushRender();
+  SyncBackend(false);
+  FlushVRAMWrites();
   DeactivateROV();
 
   GL_SCOPE("UpdateDisplay()");
@@ -3750,7 +5019,7 @@ void GPU_HW::UpdateDisplay()
   }
 
   if (drew_anything)
-    RestoreDeviceContext();
+    RestoreDeviceState();
 }
 
 void GPU_HW::UpdateDownsamplingLevels()
@@ -3911,7 +5180,7 @@ void GPU_HW::DownsampleFramebufferAdaptive(GPUTexture* source, u32 left, u32 top
 
   GL_POP();
 
-  RestoreDeviceContext();
+  RestoreDeviceState();
 
   SetDisplayTexture(m_downsample_texture.get(), m_display_depth_buffer, 0, 0, width, height);
 }
@@ -3949,7 +5218,7 @@ void GPU_HW::DownsampleFramebufferBoxFilter(GPUTexture* source, u32 left, u32 to
   g_gpu_device->PushUniformBuffer(uniforms, sizeof(uniforms));
   g_gpu_device->Draw(3, 0);
 
-  RestoreDeviceContext();
+  RestoreDeviceState();
 
   SetDisplayTexture(m_downsample_texture.get(), m_display_depth_buffer, 0, 0, ds_width, ds_height);
 }
@@ -11,6 +11,7 @@
 #include "common/dimensional_array.h"
 #include "common/gsvector.h"
 
+#include <atomic>
 #include <limits>
 #include <tuple>
 #include <utility>
@@ -18,8 +19,6 @@
 class Error;
 
 class GPU_SW_Backend;
-struct GPUBackendCommand;
-struct GPUBackendDrawCommand;
 
 class GPU_HW final : public GPU
 {
@@ -63,6 +62,7 @@ public:
   bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display) override;
 
   void RestoreDeviceContext() override;
+  void SyncRenderer() override;
 
   void UpdateSettings(const Settings& old_settings) override;
   void UpdateResolutionScale() override final;
@@ -72,9 +72,16 @@ public:
   void UpdateDisplay() override;
 
 private:
+  /// Runs the batching and device work for queued commands on its own thread.
+  class Backend;
+
   enum : u32
   {
     MAX_BATCH_VERTEX_COUNTER_IDS = 65536 - 2,
+    MAX_BATCH_SPLITS = 64,
+    MAX_PENDING_VRAM_WRITES = 64,
+    MAX_PENDING_VRAM_WRITE_PIXELS = 64 * 64,
+    VRAM_WRITE_STAGING_PIXELS = 64 * 1024,
     MAX_VERTICES_FOR_RECTANGLE = 6 * (((MAX_PRIMITIVE_WIDTH + (TEXTURE_PAGE_WIDTH - 1)) / TEXTURE_PAGE_WIDTH) + 1u) *
                                  (((MAX_PRIMITIVE_HEIGHT + (TEXTURE_PAGE_HEIGHT - 1)) / TEXTURE_PAGE_HEIGHT) + 1u),
     NUM_TEXTURE_MODES = static_cast<u32>(BatchTextureMode::MaxCount),
@@ -101,6 +108,8 @@ private:
 
     void Set(float x_, float y_, float z_, float w_, u32 color_, u32 texpage_, u16 packed_texcoord, u32 uv_limits_);
     void Set(float x_, float y_, float z_, float w_, u32 color_, u32 texpage_, u16 u_, u16 v_, u32 uv_limits_);
+    void SetPosition(const GSVector4 xyzw);
+    void SetAttributes(const GSVector4i color_texpage_uv_limits);
     static u32 PackUVLimits(u32 min_u, u32 max_u, u32 min_v, u32 max_v);
     void SetUVLimits(u32 min_u, u32 max_u, u32 min_v, u32 max_v);
   };
@@ -129,6 +138,55 @@ private:
     u32 u_set_mask_while_drawing;
   };
 
+  /// Range of indices in the mapped buffer drawn with a different pipeline/uniforms to the current batch.
+  struct BatchSplit
+  {
+    BatchConfig config;
+    BatchUBOData ubo_data;
+    u16 start_index;
+    u16 index_count;
+    bool ubo_dirty;
+  };
+
+  /// Small CPU->VRAM transfer, held in the staging buffer until the writes are flushed.
+  struct PendingVRAMWrite
+  {
+    GSVector4i bounds;
+    u16 x;
+    u16 y;
+    u16 width;
+    u16 height;
+    u32 staging_offset;
+    float depth_value;
+    bool set_mask;
+    bool depth_test;
+  };
+
+  /// Dirty VRAM areas at 16x16 tile granularity. Each tile row is a 64-bit column mask, with a summary mask of
+  /// non-empty rows so that queries against clean areas can be rejected without touching the rows.
+  struct VRAMDirtyTiles
+  {
+    static constexpr u32 TILE_SHIFT = 4;
+    static constexpr u32 NUM_ROWS = VRAM_HEIGHT >> TILE_SHIFT;
+    static_assert((VRAM_WIDTH >> TILE_SHIFT) == 64 && NUM_ROWS <= 32);
+
+    std::array<u64, NUM_ROWS> rows;
+    u32 row_mask;
+
+    void Clear();
+    void SetAll();
+    void Add(const GSVector4i rect);
+    void Add(const VRAMDirtyTiles& tiles);
+    bool Intersects(const GSVector4i rect) const;
+
+    /// Invokes the callback for each dirty area, coalescing consecutive rows with the same column span.
+    template<typename T>
+    void EnumerateRects(const T& callback) const;
+
+  private:
+    static bool GetTileRange(GSVector4i rect, u64* col_mask, u32* first_row, u32* last_row);
+  };
+
   struct RendererStats
   {
     u32 num_batches;
@@ -151,8 +209,6 @@ private:
   bool CompilePipelines(Error* error);
   void DestroyPipelines();
 
-  void LoadVertices();
-
   void PrintSettingsToLog();
   void CheckSettings();
 
@@ -166,6 +222,11 @@ private:
   void MapGPUBuffer(u32 required_vertices, u32 required_indices);
   void UnmapGPUBuffer(u32 used_vertices, u32 used_indices);
   void DrawBatchVertices(BatchRenderMode render_mode, u32 num_indices, u32 base_index, u32 base_vertex);
+  void DrawBatch(u32 num_indices, u32 base_index, u32 base_vertex);
+
+  /// Ends the current batch without unmapping the vertex/index buffers, the draw is issued by FlushBatch().
+  /// Only valid for state which does not require any other GPU commands to be executed before the next draw.
+  void SplitBatch();
 
   u32 CalculateResolutionScale() const;
   GPUDownsampleMode GetDownsampleMode(u32 resolution_scale) const;
@@ -179,11 +240,21 @@ private:
   void AddWrittenRectangle(const GSVector4i rect);
   void AddDrawnRectangle(const GSVector4i rect);
   void AddUnclampedDrawnRectangle(const GSVector4i rect);
-  void SetTexPageChangedOnOverlap(const GSVector4i update_rect);
+  void SetTexPageChangedOnOverlap(const GSVector4i update_rect, const VRAMDirtyTiles& update_tiles);
+  bool IntersectsDirtyDrawArea(const GSVector4i rect) const;
+  bool IntersectsDirtyWriteArea(const GSVector4i rect) const;
 
   void CheckForTexPageOverlap(GSVector4i uv_rect);
 
+  /// Draw state that the current batch is using. This lags behind the emulation state with the backend thread.
+  const GSVector4i& GetBatchDrawingArea() const;
+  const GPUDrawModeReg& GetBatchDrawMode() const;
+  const GPUTexturePaletteReg& GetBatchPaletteReg() const;
+  bool IsBatchTexturePageChanged() const;
+  void SetBatchTexturePageChanged();
+
   bool IsFlushed() const;
+  void FlushBatch();
   void EnsureVertexBufferSpace(u32 required_vertices, u32 required_indices);
   void EnsureVertexBufferSpaceForCurrentCommand();
   void ResetBatchVertexDepth();
@@ -201,18 +272,52 @@ private:
   void FillDrawCommand(GPUBackendDrawCommand* cmd, GPURenderCommand rc) const;
   void UpdateSoftwareRenderer(bool copy_vram_from_hw);
 
+  /// Same as FillBackendCommandParameters(), but with the interlacing state that the hardware renderer uses.
+  GPUBackendCommandParameters GetHardwareCommandParameters() const;
+  void FillHardwareDrawCommand(GPUBackendDrawCommand* cmd, GPURenderCommand rc);
+
+  /// Creates or destroys the backend thread to match the current settings.
+  void UpdateBackendThread();
+  void CopyDrawStateToBackend();
+
+  /// Queues a command for the backend thread.
+  void PushBackendCommand(GPUBackendCommand* cmd);
+
+  /// Flushes the current batch, and waits for the backend to execute all queued commands.
+  void SyncBackend(bool allow_sleep);
+
+  /// Rebinds the VRAM render target and state after other device work. Only called by the backend.
+  void RestoreDeviceState();
+
   void FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color) override;
   void ReadVRAM(u32 x, u32 y, u32 width, u32 height) override;
   void UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, bool set_mask, bool check_mask) override;
   void CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height) override;
   void DispatchRenderCommand() override;
+  void LoadVertices();
+  void QueueRenderCommand();
   void UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit) override;
   void FlushRender() override;
   void DrawRendererStats() override;
   void OnBufferSwapped() override;
 
+  // Backend side of the queued commands.
+  void FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params);
+  void UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, GPUBackendCommandParameters params);
+  void CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height, GPUBackendCommandParameters params);
+  void DrawingAreaChanged(const GSVector4i clamped_drawing_area);
+  void PrepareDraw(const GPUBackendDrawCommand* cmd, u32 required_vertices, u32 required_indices);
+  void DrawPrecisePolygon(const GPUBackendDrawPrecisePolygonCommand* cmd);
+  void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd);
+  void DrawLine(const GPUBackendDrawLineCommand* cmd);
+
   void UpdateVRAMOnGPU(u32 x, u32 y, u32 width, u32 height, const void* data, u32 data_pitch, bool set_mask,
                        bool check_mask, const GSVector4i bounds);
+  void QueueVRAMWrite(u32 x, u32 y, u32 width, u32 height, const void* data, u32 data_pitch, bool set_mask,
+                      bool check_mask, const GSVector4i bounds);
+
+  /// Applies any queued VRAM writes. Must be called before anything else reads or modifies the VRAM texture.
+  void FlushVRAMWrites();
   bool BlitVRAMReplacementTexture(const TextureReplacements::ReplacementImage* tex, u32 dst_x, u32 dst_y, u32 width,
                                   u32 height);
 
@@ -247,9 +352,21 @@ private:
   std::unique_ptr<GPUTexture> m_vram_replacement_texture;
 
   std::unique_ptr<GPUTextureBuffer> m_vram_upload_buffer;
+  std::vector<u16> m_vram_write_staging;
   std::unique_ptr<GPUTexture> m_vram_write_texture;
 
   std::unique_ptr<GPU_SW_Backend> m_sw_renderer;
+  std::unique_ptr<Backend> m_backend; // only created when using the backend thread
+
+  // Set on the emulation thread when commands have been queued since the last sync.
+  bool m_backend_commands_queued = false;
+
+  // Copies of the emulation state as of the last command executed by the backend.
+  GSVector4i m_backend_drawing_area = GSVector4i::zero();
+  GPUDrawModeReg m_backend_draw_mode = {};
+  GPUTexturePaletteReg m_backend_palette_reg = {};
+  bool m_backend_texture_page_changed = false;
+  bool m_backend_texture_window_changed = false;
 
   BatchVertex* m_batch_vertex_ptr = nullptr;
   u16* m_batch_index_ptr = nullptr;
@@ -259,8 +376,15 @@ private:
   u16 m_batch_index_count = 0;
   u16 m_batch_vertex_space = 0;
   u16 m_batch_index_space = 0;
+  u16 m_batch_split_start_index = 0;
+  u32 m_num_batch_splits = 0;
+  u32 m_num_pending_vram_writes = 0;
+  u32 m_vram_write_staging_used = 0;
   s32 m_current_depth = 0;
+  u32 m_current_required_vertices = 0;
+  u32 m_current_required_indices = 0;
   float m_last_depth_z = 1.0f;
+  float m_pgxp_depth_clear_threshold = 0.0f;
 
   u8 m_resolution_scale = 1;
   u8 m_multisamples = 1;
@@ -282,13 +406,17 @@ private:
   bool m_prefer_shader_blend : 1 = false;
   bool m_use_rov_for_shader_blend : 1 = false;
   bool m_write_mask_as_depth : 1 = false;
-  bool m_depth_was_copied : 1 = false;
   bool m_texture_window_active : 1 = false;
   bool m_rov_active : 1 = false;
 
   u8 m_texpage_dirty = 0;
 
+  // Cleared by the emulation thread when the display buffer is swapped.
+  std::atomic_bool m_depth_was_copied{false};
+
   BatchConfig m_batch;
+  std::array<BatchSplit, MAX_BATCH_SPLITS> m_batch_splits;
+  std::array<PendingVRAMWrite, MAX_PENDING_VRAM_WRITES> m_pending_vram_writes;
 
   // Changed state
   bool m_batch_ubo_dirty = true;
@@ -297,6 +425,8 @@ private:
   // Bounding box of VRAM area that the GPU has drawn into.
   GSVector4i m_vram_dirty_draw_rect = INVALID_RECT;
   GSVector4i m_vram_dirty_write_rect = INVALID_RECT;
+  VRAMDirtyTiles m_vram_dirty_draw_tiles = {};
+  VRAMDirtyTiles m_vram_dirty_write_tiles = {};
   GSVector4i m_current_uv_rect = INVALID_RECT;
   s32 m_current_texture_page_offset[2] = {};
 
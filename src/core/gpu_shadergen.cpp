@@ -135,16 +135,19 @@ std::string GPUShaderGen::GenerateDeinterlaceBlendFragmentShader()
 {
   std::stringstream ss;
   WriteHeader(ss);
+  DeclareUniformBuffer(ss, {"uint2 u_src_offset", "uint u_line_skip"}, true);
   DeclareTexture(ss, "samp0", 0, false);
   DeclareTexture(ss, "samp1", 1, false);
 
-  DeclareFragmentEntryPoint(ss, 0, 1, {}, true);
+  // Second output stores the current field, which is the previous field for the next frame.
+  DeclareFragmentEntryPoint(ss, 0, 1, {}, true, 2);
   ss << R"(
 {
   uint2 uv = uint2(v_pos.xy);
-  float4 c0 = LOAD_TEXTURE(samp0, int2(uv), 0);
+  float4 c0 = LOAD_TEXTURE(samp0, int2(u_src_offset + uint2(uv.x, uv.y << u_line_skip)), 0);
   float4 c1 = LOAD_TEXTURE(samp1, int2(uv), 0);
   o_col0 = (c0 + c1) * 0.5f;
+  o_col1 = c0;
 }
 )";
 
@@ -155,29 +158,41 @@ std::string GPUShaderGen::GenerateFastMADReconstructFragmentShader()
 {
   std::stringstream ss;
   WriteHeader(ss);
-  DeclareUniformBuffer(ss, {"uint u_current_field", "uint u_height"}, true);
+  DeclareUniformBuffer(ss, {"uint2 u_src_offset", "uint u_line_skip", "uint u_current_field", "uint u_height"},
+                       true);
   DeclareTexture(ss, "samp0", 0, false);
   DeclareTexture(ss, "samp1", 1, false);
   DeclareTexture(ss, "samp2", 2, false);
   DeclareTexture(ss, "samp3", 3, false);
 
+  // Fields are read straight from the source texture. Previous fields are stored at full height, with each line
+  // written twice, so that they can be written as the second output of this pass.
   ss << R"(
 CONSTANT float3 SENSITIVITY = float3(0.08f, 0.08f, 0.08f);
+
+float3 LoadCurrentField(int2 uv)
+{
+  int field_line = clamp(uv.y, 0, int(u_height >> 1) - 1);
+  return LOAD_TEXTURE(samp0, int2(u_src_offset) + int2(uv.x, field_line << int(u_line_skip)), 0).rgb;
+}
+
+#define LOAD_PREVIOUS_FIELD(samp, uv) \
+  LOAD_TEXTURE(samp, int2((uv).x, clamp((uv).y, 0, int(u_height >> 1) - 1) * 2), 0).rgb
 )";
 
-  DeclareFragmentEntryPoint(ss, 0, 1, {}, true);
+  DeclareFragmentEntryPoint(ss, 0, 1, {}, true, 2);
   ss << R"(
 {
   int2 uv = int2(int(v_pos.x), int(v_pos.y) >> 1);
-  float3 cur = LOAD_TEXTURE(samp0, uv, 0).rgb;
+  float3 cur = LoadCurrentField(uv);
 
-  float3 hn = LOAD_TEXTURE(samp0, uv + int2(0, -1), 0).rgb;
-  float3 cn = LOAD_TEXTURE(samp1, uv, 0).rgb;
-  float3 ln = LOAD_TEXTURE(samp0, uv + int2(0, 1), 0).rgb;
+  float3 hn = LoadCurrentField(uv + int2(0, -1));
+  float3 cn = LOAD_PREVIOUS_FIELD(samp1, uv);
+  float3 ln = LoadCurrentField(uv + int2(0, 1));
 
-  float3 ho = LOAD_TEXTURE(samp2, uv + int2(0, -1), 0).rgb;
-  float3 co = LOAD_TEXTURE(samp3, uv, 0).rgb;
-  float3 lo = LOAD_TEXTURE(samp2, uv + int2(0, 1), 0).rgb;
+  float3 ho = LOAD_PREVIOUS_FIELD(samp2, uv + int2(0, -1));
+  float3 co = LOAD_PREVIOUS_FIELD(samp3, uv);
+  float3 lo = LOAD_PREVIOUS_FIELD(samp2, uv + int2(0, 1));
 
   float3 mh = abs(hn.rgb - ho.rgb) - SENSITIVITY;
   float3 mc = abs(cn.rgb - co.rgb) - SENSITIVITY;
@@ -204,6 +219,7 @@ CONSTANT float3 SENSITIVITY = float3(0.08f, 0.08f, 0.08f);
     o_col0.rgb = cn;
   }
   o_col0.a = 1.0f;
+  o_col1 = float4(cur, 1.0f);
 }
 )";
 
@@ -8,11 +8,20 @@
 
 #include "util/gpu_device.h"
 
+#include "common/log.h"
+
+#include "cpuinfo.h"
+
 #include <algorithm>
 
+Log_SetChannel(GPU_SW_Backend);
+
 GPU_SW_Backend::GPU_SW_Backend() = default;
 
-GPU_SW_Backend::~GPU_SW_Backend() = default;
+GPU_SW_Backend::~GPU_SW_Backend()
+{
+  StopWorkerThreads();
+}
 
 bool GPU_SW_Backend::Initialize(bool force_thread)
 {
@@ -26,7 +35,177 @@ void GPU_SW_Backend::Reset()
   GPUBackend::Reset();
 }
 
+void GPU_SW_Backend::Shutdown()
+{
+  GPUBackend::Shutdown();
+  StopWorkerThreads();
+}
+
+void GPU_SW_Backend::StartWorkerThreads()
+{
+  if (m_num_workers > 0)
+    return;
+
+  const u32 num_cores = cpuinfo_initialize() ? cpuinfo_get_cores_count() : 0;
+  const u32 num_workers =
+    (num_cores > RESERVED_CORES) ? std::min<u32>(num_cores - RESERVED_CORES, MAX_WORKER_THREADS) : 0;
+  if (num_workers == 0)
+    return;
+
+  m_workers_shutdown = false;
+  for (u32 i = 0; i < num_workers; i++)
+    m_workers[i].thread.Start([this, i]() { WorkerThreadEntryPoint(i); });
+
+  m_num_workers = num_workers;
+  INFO_LOG("Started {} software rasterizer worker threads.", num_workers);
+}
+
+void GPU_SW_Backend::StopWorkerThreads()
+{
+  if (m_num_workers == 0)
+    return;
+
+  m_workers_shutdown = true;
+  for (u32 i = 0; i < m_num_workers; i++)
+    m_workers[i].start_semaphore.Post();
+  for (u32 i = 0; i < m_num_workers; i++)
+    m_workers[i].thread.Join();
+
+  m_num_workers = 0;
+}
+
+void GPU_SW_Backend::WorkerThreadEntryPoint(u32 index)
+{
+  Threading::SetNameOfCurrentThread(TinyString::from_format("SW Rasterizer Worker {}", index).c_str());
+
+  Worker& worker = m_workers[index];
+  for (;;)
+  {
+    worker.start_semaphore.Wait();
+    if (m_workers_shutdown)
+      break;
+
+    DrawBand(index + 1);
+    m_workers_done_semaphore.Post();
+  }
+}
+
+bool GPU_SW_Backend::ShouldDrawInParallel(const GPUBackendDrawCommand* cmd, s32 left, s32 top, s32 right,
+                                          s32 bottom) const
+{
+  if (m_num_workers == 0)
+    return false;
+
+  // clip to the drawing area, that's all we'll actually touch
+  left = std::max(left, static_cast<s32>(m_drawing_area.left));
+  top = std::max(top, static_cast<s32>(m_drawing_area.top));
+  right = std::min(right, static_cast<s32>(m_drawing_area.right));
+  bottom = std::min(bottom, static_cast<s32>(m_drawing_area.bottom));
+  if (left > right || (bottom - top) < static_cast<s32>(m_num_workers) ||
+      ((right - left + 1) * (bottom - top + 1)) < static_cast<s32>(MIN_PARALLEL_DRAW_AREA))
+  {
+    return false;
+  }
+
+  // texels must not change while other bands are still reading them
+  if (cmd->rc.texture_enable)
+  {
+    const GSVector4i page_rect = cmd->draw_mode.GetTexturePageRectangle();
+    if (page_rect.right > static_cast<s32>(VRAM_WIDTH) ||
+        page_rect.rintersects(GSVector4i(left, top, right + 1, bottom + 1)))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void GPU_SW_Backend::DrawInParallel(const GPUBackendDrawCommand* cmd, s32 top, s32 bottom)
+{
+  m_parallel_cmd = cmd;
+  m_parallel_top = std::max(top, static_cast<s32>(m_drawing_area.top));
+  m_parallel_bottom = std::min(bottom, static_cast<s32>(m_drawing_area.bottom));
+
+  for (u32 i = 0; i < m_num_workers; i++)
+    m_workers[i].start_semaphore.Post();
+
+  DrawBand(0);
+
+  for (u32 i = 0; i < m_num_workers; i++)
+    m_workers_done_semaphore.Wait();
+}
+
+void GPU_SW_Backend::DrawBand(u32 band)
+{
+  // The outer bands extend to the edges of the drawing area, so rows outside the bounds (e.g. from wrapped vertex
+  // positions) are still drawn exactly once.
+  const s32 num_bands = static_cast<s32>(m_num_workers + 1);
+  const s32 num_rows = m_parallel_bottom - m_parallel_top + 1;
+  const s32 band_index = static_cast<s32>(band);
+  const s32 band_top = (band_index == 0) ? static_cast<s32>(m_drawing_area.top) :
+                                           (m_parallel_top + (num_rows * band_index) / num_bands);
+  const s32 band_bottom = (band_index == (num_bands - 1)) ?
+                            static_cast<s32>(m_drawing_area.bottom) :
+                            (m_parallel_top + (num_rows * (band_index + 1)) / num_bands - 1);
+
+  GPU_SW_Rasterizer::g_drawing_area = m_drawing_area;
+
+  if (m_parallel_cmd->type == GPUBackendCommandType::DrawPolygon)
+  {
+    GPU_SW_Rasterizer::g_drawing_area.top = static_cast<u32>(band_top);
+    GPU_SW_Rasterizer::g_drawing_area.bottom = static_cast<u32>(band_bottom);
+    DrawPolygonTriangles(static_cast<const GPUBackendDrawPolygonCommand*>(m_parallel_cmd));
+  }
+  else
+  {
+    // Split rectangles rather than clipping them, the texture coordinates are relative to the first row.
+    const GPUBackendDrawRectangleCommand* cmd = static_cast<const GPUBackendDrawRectangleCommand*>(m_parallel_cmd);
+    const s32 start_y = std::max(band_top, cmd->y);
+    const s32 end_y = std::min(band_bottom, cmd->y + static_cast<s32>(cmd->height) - 1);
+    if (start_y > end_y)
+      return;
+
+    GPUBackendDrawRectangleCommand band_cmd = *cmd;
+    const u32 offset_y = static_cast<u32>(start_y - cmd->y);
+    band_cmd.y = start_y;
+    band_cmd.height = static_cast<u16>(end_y - start_y + 1);
+    band_cmd.texcoord =
+      static_cast<u16>((cmd->texcoord & 0xFFu) | (((ZeroExtend32(cmd->texcoord >> 8) + offset_y) & 0xFFu) << 8));
+
+    const GPURenderCommand rc{cmd->rc.bits};
+    GPU_SW_Rasterizer::GetDrawRectangleFunction(rc.texture_enable, rc.raw_texture_enable,
+                                                rc.transparency_enable)(&band_cmd);
+  }
+}
+
 void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
+{
+  const u32 num_vertices = cmd->rc.quad_polygon ? 4 : 3;
+  s32 min_x = cmd->vertices[0].x, max_x = cmd->vertices[0].x;
+  s32 min_y = cmd->vertices[0].y, max_y = cmd->vertices[0].y;
+  for (u32 i = 1; i < num_vertices; i++)
+  {
+    min_x = std::min(min_x, cmd->vertices[i].x);
+    max_x = std::max(max_x, cmd->vertices[i].x);
+    min_y = std::min(min_y, cmd->vertices[i].y);
+    max_y = std::max(max_y, cmd->vertices[i].y);
+  }
+
+  // positions which wrap around can't be banded by their bounds
+  if (TruncateGPUVertexPosition(min_x) == min_x && TruncateGPUVertexPosition(max_x) == max_x &&
+      TruncateGPUVertexPosition(min_y) == min_y && TruncateGPUVertexPosition(max_y) == max_y &&
+      ShouldDrawInParallel(cmd, min_x, min_y, max_x, max_y))
+  {
+    DrawInParallel(cmd, min_y, max_y);
+    return;
+  }
+
+  GPU_SW_Rasterizer::g_drawing_area = m_drawing_area;
+  DrawPolygonTriangles(cmd);
+}
+
+void GPU_SW_Backend::DrawPolygonTriangles(const GPUBackendDrawPolygonCommand* cmd)
 {
   const GPURenderCommand rc{cmd->rc.bits};
   const bool dithering_enable = rc.IsDitheringEnabled() && cmd->draw_mode.dither_enable;
@@ -41,6 +220,15 @@ void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
 
 void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
 {
+  const s32 bottom = cmd->y + static_cast<s32>(cmd->height) - 1;
+  if (ShouldDrawInParallel(cmd, cmd->x, cmd->y, cmd->x + static_cast<s32>(cmd->width) - 1, bottom))
+  {
+    DrawInParallel(cmd, cmd->y, bottom);
+    return;
+  }
+
+  GPU_SW_Rasterizer::g_drawing_area = m_drawing_area;
+
   const GPURenderCommand rc{cmd->rc.bits};
 
   const GPU_SW_Rasterizer::DrawRectangleFunction DrawFunction =
@@ -51,6 +239,8 @@ void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
 
 void GPU_SW_Backend::DrawLine(const GPUBackendDrawLineCommand* cmd)
 {
+  GPU_SW_Rasterizer::g_drawing_area = m_drawing_area;
+
   const GPU_SW_Rasterizer::DrawLineFunction DrawFunction = GPU_SW_Rasterizer::GetDrawLineFunction(
     cmd->rc.shading_enable, cmd->rc.transparency_enable, cmd->IsDitheringEnabled());
 
@@ -249,7 +439,8 @@ void GPU_SW_Backend::UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit)
 
 void GPU_SW_Backend::DrawingAreaChanged(const GPUDrawingArea& new_drawing_area, const GSVector4i clamped_drawing_area)
 {
-  GPU_SW_Rasterizer::g_drawing_area = new_drawing_area;
+  // Copied to the rasterizer's thread-local area when drawing, since this can be called on the CPU thread.
+  m_drawing_area = new_drawing_area;
 }
 
 void GPU_SW_Backend::FlushRender()
@@ -6,6 +6,8 @@
 #include "gpu.h"
 #include "gpu_backend.h"
 
+#include "common/threading.h"
+
 #include <array>
 
 class GPU_SW_Backend final : public GPUBackend
@@ -16,6 +18,12 @@ public:
 
   bool Initialize(bool force_thread) override;
   void Reset() override;
+  void Shutdown() override;
+
+  /// Starts helper threads which rasterize horizontal bands of large primitives alongside the backend thread.
+  /// The number of threads is based on the host core count, leaving room for the CPU and host GPU threads.
+  void StartWorkerThreads();
+  void StopWorkerThreads();
 
 protected:
   void FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params) override;
@@ -29,4 +37,39 @@ protected:
   void DrawingAreaChanged(const GPUDrawingArea& new_drawing_area, const GSVector4i clamped_drawing_area) override;
   void UpdateCLUT(GPUTexturePaletteReg reg, bool clut_is_8bit) override;
   void FlushRender() override;
+
+private:
+  enum : u32
+  {
+    MAX_WORKER_THREADS = 3,
+    RESERVED_CORES = 3,
+    MIN_PARALLEL_DRAW_AREA = 128 * 128,
+  };
+
+  struct Worker
+  {
+    Threading::Thread thread;
+    Threading::KernelSemaphore start_semaphore;
+  };
+
+  void DrawPolygonTriangles(const GPUBackendDrawPolygonCommand* cmd);
+
+  /// Returns true if the primitive covering the specified rows can be split across threads. Primitives which sample
+  /// from their own render area can't, since the bands would race on the texels.
+  bool ShouldDrawInParallel(const GPUBackendDrawCommand* cmd, s32 left, s32 top, s32 right, s32 bottom) const;
+  void DrawInParallel(const GPUBackendDrawCommand* cmd, s32 top, s32 bottom);
+  void DrawBand(u32 band);
+  void WorkerThreadEntryPoint(u32 index);
+
+  GPUDrawingArea m_drawing_area = {};
+
+  std::array<Worker, MAX_WORKER_THREADS> m_workers;
+  Threading::KernelSemaphore m_workers_done_semaphore;
+  u32 m_num_workers = 0;
+  bool m_workers_shutdown = false;
+
+  // Current parallel draw, written before the workers are woken.
+  const GPUBackendDrawCommand* m_parallel_cmd = nullptr;
+  s32 m_parallel_top = 0;
+  s32 m_parallel_bottom = 0;
 };
@@ -33,7 +33,7 @@ constinit const DitherLUT g_dither_lut = []() constexpr {
   return lut;
 }();
 
-GPUDrawingArea g_drawing_area = {};
+thread_local GPUDrawingArea g_drawing_area = {};
 } // namespace GPU_SW_Rasterizer
 
 // Default implementation definitions.
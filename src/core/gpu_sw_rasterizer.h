@@ -19,7 +19,8 @@ static constexpr u32 DITHER_LUT_SIZE = 512;
 using DitherLUT = std::array<std::array<std::array<u8, DITHER_LUT_SIZE>, DITHER_MATRIX_SIZE>, DITHER_MATRIX_SIZE>;
 extern const DitherLUT g_dither_lut;
 
-extern GPUDrawingArea g_drawing_area;
+// Thread-local, so that bands of a primitive can be clipped independently on worker threads.
+extern thread_local GPUDrawingArea g_drawing_area;
 
 using DrawRectangleFunction = void (*)(const GPUBackendDrawRectangleCommand* cmd);
 typedef const DrawRectangleFunction DrawRectangleFunctionTable[2][2][2];
@@ -607,7 +607,7 @@ static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
   ba = ba.u8to16();                               // B0A0 | B0A0 | B0A0 | B0A0
 
   const GSVector4i texcoord_x = GSVector4i(cmd->texcoord & 0xFF).add32(GSVector4i::cxpr(0, 1, 2, 3));
-  GSVector4i texcoord_y = GSVector4i(cmd->texcoord >> 8);
+  const u32 origin_texcoord_y = ZeroExtend32(cmd->texcoord >> 8);
 
   const GSVector4i clip_left = GSVector4i(g_drawing_area.left);
   const GSVector4i clip_right = GSVector4i(g_drawing_area.right);
@@ -624,6 +624,8 @@ static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
       continue;
     }
 
+    // V is derived from the row, so skipped rows still advance it.
+    const GSVector4i texcoord_y = GSVector4i(static_cast<s32>((origin_texcoord_y + offset_y) & 0xFFu));
     GSVector4i row_texcoord_x = texcoord_x;
     GSVector4i xvec = GSVector4i(origin_x).add32(GSVector4i::cxpr(0, 1, 2, 3));
     GSVector4i wvec = GSVector4i(width).sub32(GSVector4i::cxpr(1, 2, 3, 4));
@@ -650,9 +652,6 @@ static void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
       if constexpr (texture_enable)
         row_texcoord_x = row_texcoord_x.add32(GSVector4i::cxpr(4)) & GSVector4i::cxpr(0xFF);
     }
-
-    if constexpr (texture_enable)
-      texcoord_y = texcoord_y.add32(GSVector4i::cxpr(1)) & GSVector4i::cxpr(0xFF);
   }
 
   CHECK_VRAM(GPU_SW_Rasterizer::DrawRectangleFunctions[texture_enable][raw_texture_enable][transparency_enable](cmd));
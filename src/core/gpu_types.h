@@ -253,12 +253,14 @@ enum class GPUBackendCommandType : u8
 {
   Wraparound,
   Sync,
+  FlushRender,
   FillVRAM,
   UpdateVRAM,
   CopyVRAM,
   SetDrawingArea,
   UpdateCLUT,
   DrawPolygon,
+  DrawPrecisePolygon,
   DrawRectangle,
   DrawLine,
 };
@@ -275,6 +277,10 @@ union GPUBackendCommandParameters
   BitField<u8, bool, 2, 1> set_mask_while_drawing;
   BitField<u8, bool, 3, 1> check_mask_before_draw;
 
+  /// Set on draws when the texture page/palette or window has changed since the previous draw.
+  BitField<u8, bool, 4, 1> texture_page_changed;
+  BitField<u8, bool, 5, 1> texture_window_changed;
+
   ALWAYS_INLINE bool IsMaskingEnabled() const { return (bits & 12u) != 0u; }
 
   // During transfer/render operations, if ((dst_pixel & mask_and) == 0) { pixel = src_pixel | mask_or }
@@ -388,6 +394,23 @@ struct GPUBackendDrawPolygonCommand : public GPUBackendDrawCommand
   Vertex vertices[0];
 };
 
+/// Polygon with PGXP-corrected positions, used by the hardware renderer.
+struct GPUBackendDrawPrecisePolygonCommand : public GPUBackendDrawCommand
+{
+  u16 num_vertices;
+  bool pgxp;
+  bool valid_w;
+
+  struct Vertex
+  {
+    float x, y, w;
+    u32 color;
+    u16 texcoord;
+  };
+
+  Vertex vertices[0];
+};
+
 struct GPUBackendDrawRectangleCommand : public GPUBackendDrawCommand
 {
   s32 x, y;
@@ -236,6 +236,29 @@ DEFINE_HOTKEY("ToggleMediaCapture", TRANSLATE_NOOP("Hotkeys", "General"),
                 }
               })
 
+DEFINE_HOTKEY("ToggleInputMovieRecording", TRANSLATE_NOOP("Hotkeys", "General"),
+              TRANSLATE_NOOP("Hotkeys", "Toggle Input Movie Recording"), [](s32 pressed) {
+                if (!pressed && System::IsValid())
+                {
+                  Host::RunOnCPUThread([]() {
+                    if (System::GetInputMovie())
+                    {
+                      System::StopInputMovie();
+                      return;
+                    }
+
+                    Error error;
+                    if (!System::StartInputMovieRecording({}, &error))
+                    {
+                      Host::AddIconOSDWarning("InputMovie", ICON_FA_EXCLAMATION_TRIANGLE,
+                                              fmt::format(TRANSLATE_FS("Hotkeys", "Failed to record input movie: {}"),
+                                                          error.GetDescription()),
+                                              Host::OSD_ERROR_DURATION);
+                    }
+                  });
+                }
+              })
+
 DEFINE_HOTKEY("OpenAchievements", TRANSLATE_NOOP("Hotkeys", "General"),
               TRANSLATE_NOOP("Hotkeys", "Open Achievement List"), [](s32 pressed) {
                 if (!pressed && CanPause())
@@ -441,6 +464,7 @@ DEFINE_HOTKEY("ReloadTextureReplacements", TRANSLATE_NOOP("Hotkeys", "Graphics")
                 {
                   Host::AddKeyedOSDMessage("ReloadTextureReplacements",
                                            TRANSLATE_STR("OSDMessage", "Texture replacements reloaded."), 10.0f);
+                  g_gpu->SyncRenderer();
                   TextureReplacements::Reload();
                 }
               })
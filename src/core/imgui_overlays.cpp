@@ -20,6 +20,7 @@
 #include "util/imgui_manager.h"
 #include "util/input_manager.h"
 #include "util/media_capture.h"
+#include "util/memory_usage.h"
 
 #include "common/align.h"
 #include "common/error.h"
@@ -287,6 +288,9 @@ void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, float
 
       g_gpu->GetMemoryStatsString(text);
       DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+
+      MemoryUsage::FormatSummary(text);
+      DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
     }
 
     if (g_settings.display_show_resolution)
@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#include "input_movie.h"
+#include "controller.h"
+#include "pad.h"
+#include "save_state_version.h"
+#include "system.h"
+
+#include "util/state_wrapper.h"
+
+#include "common/binary_reader_writer.h"
+#include "common/error.h"
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/path.h"
+
+Log_SetChannel(InputMovie);
+
+static_assert(NUM_CONTROLLER_AND_CARD_PORTS <= 8, "Changed port mask fits in a byte");
+
+static const char* GetControllerTypeNameForMovie(ControllerType type)
+{
+  const Controller::ControllerInfo* cinfo = Controller::GetControllerInfo(type);
+  return cinfo ? cinfo->name : "Unknown";
+}
+
+InputMovie::InputMovie(Mode mode, std::string path) : m_mode(mode), m_path(std::move(path))
+{
+}
+
+InputMovie::~InputMovie() = default;
+
+std::unique_ptr<InputMovie> InputMovie::CreateRecording(std::string path, std::string serial, u32 state_version,
+                                                        DynamicHeapArray<u8> start_state)
+{
+  std::unique_ptr<InputMovie> movie(new InputMovie(Mode::Recording, std::move(path)));
+  movie->m_serial = std::move(serial);
+  movie->m_state_version = state_version;
+  movie->m_start_state = std::move(start_state);
+  return movie;
+}
+
+std::unique_ptr<InputMovie> InputMovie::OpenPlayback(std::string path, Error* error)
+{
+  auto fp = FileSystem::OpenManagedCFile(path.c_str(), "rb", error);
+  if (!fp)
+  {
+    Error::AddPrefixFmt(error, "Cannot open '{}': ", Path::GetFileName(path));
+    return {};
+  }
+
+  const s64 file_size = FileSystem::FSize64(fp.get(), error);
+  if (file_size < 0)
+    return {};
+
+  std::unique_ptr<InputMovie> movie(new InputMovie(Mode::Playback, std::move(path)));
+  BinaryFileReader reader(fp.get());
+
+  // Sizes are checked against what is left in the file before allocating, so a corrupted header fails cleanly.
+  const auto remaining_size = [&fp, file_size]() {
+    const s64 pos = FileSystem::FTell64(fp.get());
+    return (pos >= 0 && pos <= file_size) ? static_cast<u64>(file_size - pos) : 0;
+  };
+
+  u32 magic, version;
+  if (!reader.ReadU32(&magic) || !reader.ReadU32(&version) || magic != MAGIC)
+  {
+    Error::SetStringView(error, "File is not an input movie.");
+    return {};
+  }
+  else if (version != FILE_VERSION)
+  {
+    Error::SetStringFmt(error, "Unsupported input movie version {}.", version);
+    return {};
+  }
+
+  u32 state_size;
+  if (!reader.ReadU32(&movie->m_state_version) || !reader.ReadSizePrefixedString(&movie->m_serial) ||
+      !reader.ReadU32(&state_size))
+  {
+    Error::SetStringView(error, "Failed to read input movie header.");
+    return {};
+  }
+
+  if (movie->m_state_version < SAVE_STATE_MINIMUM_VERSION || movie->m_state_version > SAVE_STATE_VERSION)
+  {
+    Error::SetStringFmt(error, "Input movie uses unsupported save state version {} (supported {}-{}).",
+                        movie->m_state_version, SAVE_STATE_MINIMUM_VERSION, SAVE_STATE_VERSION);
+    return {};
+  }
+
+  if (state_size > System::GetMaxSaveStateSize() || state_size > remaining_size())
+  {
+    Error::SetStringFmt(error, "Input movie start state size {} is invalid.", state_size);
+    return {};
+  }
+
+  movie->m_start_state.resize(state_size);
+  if (!reader.Read(movie->m_start_state.data(), state_size))
+  {
+    Error::SetStringView(error, "Failed to read input movie start state.");
+    return {};
+  }
+
+  u32 frame_count, frame_data_size;
+  if (!reader.ReadU32(&frame_count) || !reader.ReadU32(&frame_data_size))
+  {
+    Error::SetStringView(error, "Failed to read input movie frame count.");
+    return {};
+  }
+
+  // Each frame record is a 64-bit hash, 32-bit data offset and 8-bit port mask.
+  static constexpr u64 FRAME_RECORD_SIZE = sizeof(u64) + sizeof(u32) + sizeof(u8);
+  if ((static_cast<u64>(frame_count) * FRAME_RECORD_SIZE + frame_data_size) > remaining_size())
+  {
+    Error::SetStringFmt(error, "Input movie frame count {} or data size {} is invalid.", frame_count, frame_data_size);
+    return {};
+  }
+
+  movie->m_frames.resize(frame_count);
+  for (Frame& frame : movie->m_frames)
+  {
+    if (!reader.ReadU64(&frame.ram_hash) || !reader.ReadU32(&frame.data_offset) ||
+        !reader.ReadU8(&frame.changed_ports) || frame.data_offset > frame_data_size)
+    {
+      Error::SetStringView(error, "Input movie frame list is corrupted.");
+      return {};
+    }
+  }
+
+  movie->m_frame_data.resize(frame_data_size);
+  if (!reader.Read(movie->m_frame_data.data(), frame_data_size))
+  {
+    Error::SetStringView(error, "Failed to read input movie frame data.");
+    return {};
+  }
+
+  INFO_LOG("Loaded input movie '{}' with {} frames for '{}'.", Path::GetFileName(movie->m_path), frame_count,
+           movie->m_serial);
+  return movie;
+}
+
+bool InputMovie::Save(Error* error) const
+{
+  auto fp = FileSystem::CreateAtomicRenamedFile(m_path, error);
+  if (!fp)
+  {
+    Error::AddPrefixFmt(error, "Cannot open '{}': ", Path::GetFileName(m_path));
+    return false;
+  }
+
+  BinaryFileWriter writer(fp.get());
+  writer.WriteU32(MAGIC);
+  writer.WriteU32(FILE_VERSION);
+  writer.WriteU32(m_state_version);
+  writer.WriteSizePrefixedString(m_serial);
+  writer.WriteU32(static_cast<u32>(m_start_state.size()));
+  writer.Write(m_start_state.data(), m_start_state.size());
+  writer.WriteU32(static_cast<u32>(m_frames.size()));
+  writer.WriteU32(static_cast<u32>(m_frame_data.size()));
+  for (const Frame& frame : m_frames)
+  {
+    writer.WriteU64(frame.ram_hash);
+    writer.WriteU32(frame.data_offset);
+    writer.WriteU8(frame.changed_ports);
+  }
+  writer.Write(m_frame_data.data(), m_frame_data.size());
+
+  if (!writer.Flush(error))
+  {
+    FileSystem::DiscardAtomicRenamedFile(fp);
+    return false;
+  }
+
+  return FileSystem::CommitAtomicRenamedFile(fp, error);
+}
+
+void InputMovie::BeginFrame()
+{
+  if (m_mode == Mode::Playback)
+  {
+    if (m_desynced || IsPlaybackFinished())
+      return;
+
+    if (!ReadPortStates(m_frames[m_current_frame]))
+    {
+      ERROR_LOG("Input movie frame {} is corrupted.", m_current_frame);
+      m_desynced = true;
+      return;
+    }
+
+    ApplyPortStates();
+    return;
+  }
+
+  // May be called more than once per frame, e.g. when recording starts, so diff against the committed state.
+  m_pending_changed_ports = 0;
+  m_pending_data.clear();
+
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    PortState& ps = m_pending_port_states[i];
+    Controller* controller = Pad::GetController(i);
+    ps.type = controller ? controller->GetType() : ControllerType::None;
+    ps.data.clear();
+    if (controller)
+    {
+      std::array<u8, MAX_PORT_STATE_SIZE> buffer;
+      StateWrapper sw(std::span<u8>(buffer), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
+      if (!controller->DoState(sw, true))
+      {
+        ERROR_LOG("Failed to serialize controller {} state.", i + 1u);
+        continue;
+      }
+
+      ps.data.assign(buffer.begin(), buffer.begin() + sw.GetPosition());
+    }
+
+    const PortState& prev_ps = m_port_states[i];
+    if (ps.type == prev_ps.type && ps.data == prev_ps.data)
+      continue;
+
+    m_pending_changed_ports |= static_cast<u8>(1u << i);
+    m_pending_data.push_back(static_cast<u8>(ps.type));
+    m_pending_data.push_back(static_cast<u8>(ps.data.size()));
+    m_pending_data.push_back(static_cast<u8>(ps.data.size() >> 8));
+    m_pending_data.insert(m_pending_data.end(), ps.data.begin(), ps.data.end());
+  }
+}
+
+void InputMovie::EndFrame(u64 ram_hash)
+{
+  if (m_mode == Mode::Playback)
+  {
+    if (m_desynced || IsPlaybackFinished())
+      return;
+
+    const Frame& frame = m_frames[m_current_frame];
+    if (frame.ram_hash != ram_hash)
+    {
+      ERROR_LOG("Input movie desync at frame {}: expected RAM hash {:016X}, got {:016X}.", m_current_frame,
+                frame.ram_hash, ram_hash);
+      m_desynced = true;
+      return;
+    }
+
+    m_current_frame++;
+    return;
+  }
+
+  m_frames.push_back(Frame{ram_hash, static_cast<u32>(m_frame_data.size()), m_pending_changed_ports});
+  m_frame_data.insert(m_frame_data.end(), m_pending_data.begin(), m_pending_data.end());
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    if (m_pending_changed_ports & (1u << i))
+      std::swap(m_port_states[i], m_pending_port_states[i]);
+  }
+
+  m_pending_changed_ports = 0;
+  m_pending_data.clear();
+  m_current_frame++;
+}
+
+bool InputMovie::ReadPortStates(const Frame& frame)
+{
+  BinarySpanReader reader(std::span<const u8>(m_frame_data).subspan(frame.data_offset));
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    if (!(frame.changed_ports & (1u << i)))
+      continue;
+
+    u8 type;
+    u16 size;
+    if (!reader.ReadU8(&type) || !reader.ReadU16(&size) || type >= static_cast<u8>(ControllerType::Count) ||
+        size > reader.GetBufferRemaining())
+    {
+      return false;
+    }
+
+    PortState& ps = m_port_states[i];
+    ps.type = static_cast<ControllerType>(type);
+    ps.data.resize(size);
+    reader.Read(ps.data.data(), size);
+  }
+
+  return true;
+}
+
+void InputMovie::ApplyPortStates()
+{
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    const PortState& ps = m_port_states[i];
+    Controller* controller = Pad::GetController(i);
+    const ControllerType type = controller ? controller->GetType() : ControllerType::None;
+    if (type != ps.type)
+    {
+      ERROR_LOG("Input movie expects a {} in port {}, but a {} is connected.", GetControllerTypeNameForMovie(ps.type),
+                i + 1u, GetControllerTypeNameForMovie(type));
+      m_desynced = true;
+      return;
+    }
+
+    if (!controller)
+      continue;
+
+    StateWrapper sw(std::span<const u8>(ps.data), StateWrapper::Mode::Read, m_state_version);
+    if (!controller->DoState(sw, true))
+    {
+      ERROR_LOG("Failed to restore controller {} state from input movie.", i + 1u);
+      m_desynced = true;
+      return;
+    }
+  }
+}
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#pragma once
+
+#include "types.h"
+
+#include "common/heap_array.h"
+
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+class Error;
+
+/// Per-frame recording of controller state, starting from an embedded save state. Each frame also stores a hash
+/// of main RAM at the end of the frame, so playback can detect when emulation has diverged from the recording.
+class InputMovie final
+{
+public:
+  enum class Mode : u8
+  {
+    Recording,
+    Playback,
+  };
+
+  ~InputMovie();
+
+  /// Begins a new recording. The start state must have been captured at a frame boundary.
+  static std::unique_ptr<InputMovie> CreateRecording(std::string path, std::string serial, u32 state_version,
+                                                     DynamicHeapArray<u8> start_state);
+
+  /// Loads an existing movie for playback.
+  static std::unique_ptr<InputMovie> OpenPlayback(std::string path, Error* error);
+
+  ALWAYS_INLINE Mode GetMode() const { return m_mode; }
+  ALWAYS_INLINE bool IsRecording() const { return (m_mode == Mode::Recording); }
+  ALWAYS_INLINE bool IsPlayback() const { return (m_mode == Mode::Playback); }
+  ALWAYS_INLINE const std::string& GetPath() const { return m_path; }
+  ALWAYS_INLINE const std::string& GetSerial() const { return m_serial; }
+  ALWAYS_INLINE u32 GetStateVersion() const { return m_state_version; }
+  ALWAYS_INLINE DynamicHeapArray<u8>& GetStartState() { return m_start_state; }
+
+  /// Number of complete frames in the movie, and the index of the frame currently executing.
+  ALWAYS_INLINE u32 GetFrameCount() const { return static_cast<u32>(m_frames.size()); }
+  ALWAYS_INLINE u32 GetCurrentFrame() const { return m_current_frame; }
+
+  /// Returns true once every recorded frame has been played back.
+  ALWAYS_INLINE bool IsPlaybackFinished() const { return (IsPlayback() && m_current_frame >= GetFrameCount()); }
+
+  /// Returns true if a frame hash did not match, or the controller setup differs from the recording.
+  ALWAYS_INLINE bool HasDesynced() const { return m_desynced; }
+
+  /// Called after host input has been polled. Captures controller state when recording, or replaces it when playing.
+  void BeginFrame();
+
+  /// Called when the frame finishes. Records the RAM hash, or compares it against the recording.
+  void EndFrame(u64 ram_hash);
+
+  /// Writes the recording to its path.
+  bool Save(Error* error) const;
+
+private:
+  static constexpr u32 MAGIC = 0x564D5344; // DSMV
+  static constexpr u32 FILE_VERSION = 1;
+  static constexpr u32 MAX_PORT_STATE_SIZE = 256;
+
+  struct Frame
+  {
+    u64 ram_hash;
+    u32 data_offset;
+    u8 changed_ports;
+  };
+
+  struct PortState
+  {
+    ControllerType type;
+    std::vector<u8> data;
+  };
+
+  InputMovie(Mode mode, std::string path);
+
+  bool ReadPortStates(const Frame& frame);
+  void ApplyPortStates();
+
+  Mode m_mode;
+  bool m_desynced = false;
+  u32 m_state_version = 0;
+  u32 m_current_frame = 0;
+  std::string m_path;
+  std::string m_serial;
+  DynamicHeapArray<u8> m_start_state;
+
+  std::vector<Frame> m_frames;
+  std::vector<u8> m_frame_data;
+
+  /// Controller state as of the most recent frame.
+  std::array<PortState, NUM_CONTROLLER_AND_CARD_PORTS> m_port_states = {};
+
+  /// Recording only: changes for the frame in progress, committed by EndFrame().
+  u8 m_pending_changed_ports = 0;
+  std::vector<u8> m_pending_data;
+  std::array<PortState, NUM_CONTROLLER_AND_CARD_PORTS> m_pending_port_states = {};
+};
@@ -101,8 +101,9 @@ static constexpr TickCount GetACKTicks(bool memory_card)
 static void SoftReset();
 static void UpdateJoyStat();
 static void TransferEvent(void*, TickCount ticks, TickCount ticks_late);
+static void UpdateTransfer();
 static void BeginTransfer();
-static void DoTransfer(TickCount ticks_late);
+static void DoTransfer();
 static void DoACK();
 static void EndTransfer();
 static void ResetDeviceTransferState();
@@ -130,6 +131,8 @@ static ActiveDevice s_active_device = ActiveDevice::None;
 static u8 s_receive_buffer = 0;
 static u8 s_transmit_buffer = 0;
 static u8 s_transmit_value = 0;
+static TickCount s_transfer_ticks = 0;
+static TickCount s_ack_ticks = 0;
 static bool s_receive_buffer_full = false;
 static bool s_transmit_buffer_full = false;
 
@@ -524,6 +527,67 @@ bool Pad::DoState(StateWrapper& sw, bool is_memory_state)
   sw.Do(&s_receive_buffer_full);
   sw.Do(&s_transmit_buffer_full);
 
+  if (sw.GetVersion() >= 74) [[likely]]
+  {
+    sw.Do(&s_transmit_value);
+    sw.Do(&s_transfer_ticks);
+    sw.Do(&s_ack_ticks);
+  }
+  else if (sw.GetVersion() >= 72)
+  {
+    // These states exchanged the byte when the transfer started. The device has already seen it, so finish the
+    // transfer with its response instead of sending the byte again.
+    u8 pending_receive = 0;
+    bool pending_ack = false;
+    TickCount ack_ticks = 0;
+    sw.Do(&pending_receive);
+    sw.Do(&pending_ack);
+    sw.Do(&s_transfer_ticks);
+    sw.Do(&ack_ticks);
+    s_ack_ticks = s_transfer_ticks + ack_ticks;
+
+    if (s_state == State::Transmitting)
+    {
+      s_receive_buffer = pending_receive;
+      s_receive_buffer_full = true;
+      if (pending_ack)
+      {
+        s_state = State::WaitingForACK;
+      }
+      else
+      {
+        s_active_device = ActiveDevice::None;
+        EndTransfer();
+      }
+
+      UpdateJoyStat();
+    }
+  }
+  else
+  {
+    // Older states scheduled the event for the end of the transfer, and for the ACK on its own.
+    s_transfer_ticks = GetTransferTicks();
+    s_ack_ticks = 0;
+
+    // The byte being sent wasn't saved. It's still in the TX buffer, unless the next one has been queued since.
+    if (s_state == State::Transmitting)
+    {
+      if (!s_transmit_buffer_full)
+      {
+        s_transmit_value = s_transmit_buffer;
+      }
+      else
+      {
+        WARNING_LOG("Dropping pad transfer in progress from old save state.");
+        s_receive_buffer = 0xFF;
+        s_receive_buffer_full = true;
+        ResetDeviceTransferState();
+        EndTransfer();
+        UpdateJoyStat();
+      }
+    }
+  }
+
   if (sw.IsReading() && IsTransmitting())
     s_transfer_event.Activate();
 
@@ -573,7 +637,7 @@ u32 Pad::ReadRegister(u32 offset)
     case 0x00: // JOY_DATA
     {
       if (IsTransmitting())
-        s_transfer_event.InvokeEarly();
+        UpdateTransfer();
 
       const u8 value = s_receive_buffer_full ? s_receive_buffer : 0xFF;
       DEBUG_LOG("JOY_DATA (R) -> 0x{:02X}{}", value, s_receive_buffer_full ? "" : "(EMPTY)");
@@ -587,7 +651,7 @@ u32 Pad::ReadRegister(u32 offset)
     case 0x04: // JOY_STAT
     {
       if (IsTransmitting())
-        s_transfer_event.InvokeEarly();
+        UpdateTransfer();
 
       const u32 bits = s_JOY_STAT.bits;
       s_JOY_STAT.ACKINPUT = false;
@@ -617,6 +681,9 @@ void Pad::WriteRegister(u32 offset, u32 value)
     {
       DEBUG_LOG("JOY_DATA (W) <- 0x{:02X}", value);
 
+      if (IsTransmitting())
+        UpdateTransfer();
+
       if (s_transmit_buffer_full)
         WARNING_LOG("TX FIFO overrun");
 
@@ -633,6 +700,10 @@ void Pad::WriteRegister(u32 offset, u32 value)
     {
       DEBUG_LOG("JOY_CTRL <- 0x{:04X}", value);
 
+      // A byte which has finished shifting can't be cancelled.
+      if (IsTransmitting())
+        UpdateTransfer();
+
       s_JOY_CTRL.bits = Truncate16(value);
       if (s_JOY_CTRL.RESET)
         SoftReset();
@@ -725,9 +796,29 @@ void Pad::UpdateJoyStat()
 void Pad::TransferEvent(void*, TickCount ticks, TickCount ticks_late)
 {
   if (s_state == State::Transmitting)
-    DoTransfer(ticks_late);
-  else
-    DoACK();
+    DoTransfer();
+
+  if (s_state != State::WaitingForACK)
+    return;
+
+  // The event runs at the shortest ACK delay, the controller ACK comes later.
+  if (ticks < s_ack_ticks)
+  {
+    s_ack_ticks -= ticks;
+    s_transfer_event.SetPeriodAndSchedule(s_ack_ticks);
+    return;
+  }
+
+  DoACK();
+}
+
+void Pad::UpdateTransfer()
+{
+  // Runs the event if the ACK is due. Otherwise, the byte is exchanged once the transfer time has passed, without
+  // needing an event of its own.
+  s_transfer_event.InvokeEarly();
+  if (s_state == State::Transmitting && s_transfer_event.GetTicksSinceLastExecution() >= s_transfer_ticks)
+    DoTransfer();
 }
 
 void Pad::BeginTransfer()
@@ -753,12 +844,16 @@ void Pad::BeginTransfer()
   // controller being discarded in (4)/(5), but this bit was set by the *new* transfer. Therefore, the
   // test in (7) will fail, and it won't send any more data. So, the transfer/interrupt must be delayed
   // until after (4) and (5) have been completed.
-
+  //
+  // The device only sees the byte once it has finished shifting, since the transfer can still be cancelled. Register
+  // accesses exchange it after the transfer time, so the event only has to run for the ACK. Which device responds
+  // isn't known yet, so schedule for the shortest ACK delay.
   s_state = State::Transmitting;
-  s_transfer_event.SetPeriodAndSchedule(GetTransferTicks());
+  s_transfer_ticks = GetTransferTicks();
+  s_transfer_event.SetPeriodAndSchedule(s_transfer_ticks + GetACKTicks(true));
 }
 
-void Pad::DoTransfer(TickCount ticks_late)
+void Pad::DoTransfer()
 {
   DEBUG_LOG("Transferring slot {}", s_JOY_CTRL.SLOT.GetValue());
 
@@ -766,9 +861,6 @@ void Pad::DoTransfer(TickCount ticks_late)
   Controller* const controller = s_controllers[device_index].get();
   MemoryCard* const memory_card = s_memory_cards[device_index].get();
 
-  // set rx?
-  s_JOY_CTRL.RXEN = true;
-
   const u8 data_out = s_transmit_value;
 
   u8 data_in = 0xFF;
@@ -871,10 +963,12 @@ void Pad::DoTransfer(TickCount ticks_late)
       s_active_device == ActiveDevice::MemoryCard ||
       (s_active_device == ActiveDevice::Multitap && s_multitaps[s_JOY_CTRL.SLOT].IsReadingMemoryCard());
 
-    const TickCount ack_timer = GetACKTicks(memcard_transfer);
-    DEBUG_LOG("Delaying ACK for {} ticks", ack_timer);
+    const TickCount ack_ticks = GetACKTicks(memcard_transfer);
+    DEBUG_LOG("Delaying ACK for {} ticks", ack_ticks);
+
+    // Relative to the start of the transfer, which is when the event last ran.
+    s_ack_ticks = s_transfer_ticks + ack_ticks;
     s_state = State::WaitingForACK;
-    s_transfer_event.SetPeriodAndSchedule(ack_timer);
   }
 
   UpdateJoyStat();
@@ -10,11 +10,44 @@
 #include "common/path.h"
 #include "common/string_util.h"
 
+#include <algorithm>
+#include <cstring>
+
 Log_SetChannel(PCDrv);
 
 static constexpr u32 MAX_FILES = 100;
 
-static std::vector<FileSystem::ManagedCFilePtr> s_files;
+/// Size of the per-handle read-ahead/write-behind window. Guest code tends to read files in small chunks.
+static constexpr u32 FILE_BUFFER_SIZE = 64 * 1024;
+
+namespace {
+struct PCDrvFile
+{
+  FileSystem::ManagedCFilePtr fp;
+  std::string path;
+  bool writable = false;
+
+  /// Position as seen by the guest. The host position is always set explicitly before reading or writing.
+  s64 position = 0;
+
+  /// Window of the file which is held in the buffer, and the range within it which has not been written yet.
+  s64 buffer_offset = 0;
+  u32 buffer_size = 0;
+  u32 dirty_start = 0;
+  u32 dirty_end = 0;
+  std::unique_ptr<u8[]> buffer;
+
+  u32 num_reads = 0;
+  u32 num_writes = 0;
+  u32 num_seeks = 0;
+  u32 num_host_reads = 0;
+  u32 num_host_writes = 0;
+  u64 bytes_read = 0;
+  u64 bytes_written = 0;
+};
+} // namespace
+
+static std::vector<std::unique_ptr<PCDrvFile>> s_files;
 
 enum PCDrvAttribute : u32
 {
@@ -25,6 +58,41 @@ enum PCDrvAttribute : u32
   PCDRV_ATTRIBUTE_ARCHIVE = (1 << 5),
 };
 
+static bool FlushFileBuffer(PCDrvFile* file)
+{
+  if (file->dirty_start >= file->dirty_end)
+    return true;
+
+  const u32 start = file->dirty_start;
+  const u32 size = file->dirty_end - start;
+  file->dirty_start = 0;
+  file->dirty_end = 0;
+  file->num_host_writes++;
+  if (FileSystem::FSeek64(file->fp.get(), file->buffer_offset + start, SEEK_SET) != 0 ||
+      std::fwrite(&file->buffer[start], size, 1, file->fp.get()) != 1)
+  {
+    ERROR_LOG("Failed to write {} bytes to '{}'", size, file->path);
+    return false;
+  }
+
+  return true;
+}
+
+static bool FillFileBuffer(PCDrvFile* file, s64 offset)
+{
+  if (!FlushFileBuffer(file))
+    return false;
+
+  file->buffer_offset = offset;
+  file->buffer_size = 0;
+  file->num_host_reads++;
+  if (FileSystem::FSeek64(file->fp.get(), offset, SEEK_SET) != 0)
+    return false;
+
+  file->buffer_size = static_cast<u32>(std::fread(file->buffer.get(), 1, FILE_BUFFER_SIZE, file->fp.get()));
+  return (std::ferror(file->fp.get()) == 0);
+}
+
 static s32 GetFreeFileHandle()
 {
   for (s32 i = 0; i < static_cast<s32>(s_files.size()); i++)
@@ -40,7 +108,7 @@ static s32 GetFreeFileHandle()
   }
 
   const s32 index = static_cast<s32>(s_files.size());
-  s_files.emplace_back(nullptr, FileSystem::FileDeleter());
+  s_files.emplace_back();
   return index;
 }
 
@@ -49,10 +117,16 @@ static void CloseAllFiles()
   if (!s_files.empty())
     DEV_LOG("Closing {} open files.", s_files.size());
 
+  for (const std::unique_ptr<PCDrvFile>& file : s_files)
+  {
+    if (file)
+      FlushFileBuffer(file.get());
+  }
+
   s_files.clear();
 }
 
-static FILE* GetFileFromHandle(u32 handle)
+static PCDrvFile* GetFileFromHandle(u32 handle)
 {
   if (handle >= static_cast<u32>(s_files.size()) || !s_files[handle])
   {
@@ -65,15 +139,170 @@ static FILE* GetFileFromHandle(u32 handle)
 
 static bool CloseFileHandle(u32 handle)
 {
-  if (handle >= static_cast<u32>(s_files.size()) || !s_files[handle])
-  {
-    ERROR_LOG("Invalid file handle {}", static_cast<s32>(handle));
+  PCDrvFile* file = GetFileFromHandle(handle);
+  if (!file)
     return false;
-  }
+
+  const bool flushed = FlushFileBuffer(file);
+  DEV_LOG("PCclose({}): '{}': {} reads ({} bytes), {} writes ({} bytes), {} seeks, {} host reads, {} host writes",
+          handle, Path::GetFileName(file->path), file->num_reads, file->bytes_read, file->num_writes,
+          file->bytes_written, file->num_seeks, file->num_host_reads, file->num_host_writes);
 
   s_files[handle].reset();
   while (!s_files.empty() && !s_files.back())
     s_files.pop_back();
+  return flushed;
+}
+
+static void WriteGuestMemory(VirtualMemoryAddress address, const u8* data, u32 length)
+{
+  if (u8* ptr = CPU::GetHLEMemoryPointer(address, length)) [[likely]]
+  {
+    std::memcpy(ptr, data, length);
+    CPU::InvalidateHLEMemoryWrite(address, length);
+    return;
+  }
+
+  for (u32 i = 0; i < length; i++)
+    CPU::SafeWriteMemoryByte(address + i, data[i]);
+}
+
+static u32 ReadGuestMemory(VirtualMemoryAddress address, u8* data, u32 length)
+{
+  if (const u8* ptr = CPU::GetHLEMemoryPointer(address, length)) [[likely]]
+  {
+    std::memcpy(data, ptr, length);
+    return length;
+  }
+
+  for (u32 i = 0; i < length; i++)
+  {
+    if (!CPU::SafeReadMemoryByte(address + i, &data[i]))
+      return i;
+  }
+
+  return length;
+}
+
+static bool ReadFile(PCDrvFile* file, VirtualMemoryAddress address, u32 count)
+{
+  file->num_reads++;
+
+  u32 done = 0;
+  while (done < count)
+  {
+    const u32 remaining = count - done;
+    const s64 buffer_end = file->buffer_offset + file->buffer_size;
+    if (file->position >= file->buffer_offset && file->position < buffer_end)
+    {
+      const u32 offset = static_cast<u32>(file->position - file->buffer_offset);
+      const u32 size = std::min(remaining, file->buffer_size - offset);
+      WriteGuestMemory(address + done, &file->buffer[offset], size);
+      file->position += size;
+      file->bytes_read += size;
+      done += size;
+      continue;
+    }
+
+    // Large reads bypass the buffer, and go straight into RAM.
+    u8* ptr;
+    if (remaining >= FILE_BUFFER_SIZE && (ptr = CPU::GetHLEMemoryPointer(address + done, remaining)) != nullptr)
+    {
+      if (!FlushFileBuffer(file) || FileSystem::FSeek64(file->fp.get(), file->position, SEEK_SET) != 0)
+        return false;
+
+      file->num_host_reads++;
+      const u32 size = static_cast<u32>(std::fread(ptr, 1, remaining, file->fp.get()));
+      if (std::ferror(file->fp.get()) != 0)
+        return false;
+
+      // Does not stop at EOF according to psx-spx.
+      std::memset(ptr + size, 0, remaining - size);
+      CPU::InvalidateHLEMemoryWrite(address + done, remaining);
+      file->position += size;
+      file->bytes_read += size;
+      return true;
+    }
+
+    if (!FillFileBuffer(file, file->position))
+      return false;
+
+    if (file->buffer_size == 0)
+    {
+      // Past EOF, the remainder is zero-filled, and the position does not move.
+      for (u32 i = done; i < count; i++)
+        CPU::SafeWriteMemoryByte(address + i, 0);
+      break;
+    }
+  }
+
+  return true;
+}
+
+static bool WriteFile(PCDrvFile* file, VirtualMemoryAddress address, u32 count, u32* written)
+{
+  file->num_writes++;
+  if (!file->writable)
+  {
+    ERROR_LOG("Attempting to write to read-only file '{}'", file->path);
+    return false;
+  }
+
+  u32 done = 0;
+  while (done < count)
+  {
+    const u32 remaining = count - done;
+
+    // Large writes go straight from RAM, after dropping the buffer since it may overlap.
+    const u8* ptr;
+    if (remaining >= FILE_BUFFER_SIZE && (ptr = CPU::GetHLEMemoryPointer(address + done, remaining)) != nullptr)
+    {
+      if (!FlushFileBuffer(file))
+        return false;
+
+      file->buffer_size = 0;
+      file->num_host_writes++;
+      if (FileSystem::FSeek64(file->fp.get(), file->position, SEEK_SET) != 0 ||
+          std::fwrite(ptr, remaining, 1, file->fp.get()) != 1)
+      {
+        return false;
+      }
+
+      file->position += remaining;
+      file->bytes_written += remaining;
+      done = count;
+      break;
+    }
+
+    // Writes can extend the window, but there can't be any gaps in it.
+    const s64 buffer_end = file->buffer_offset + file->buffer_size;
+    if (file->position < file->buffer_offset || file->position > buffer_end ||
+        file->position >= (file->buffer_offset + FILE_BUFFER_SIZE))
+    {
+      if (!FlushFileBuffer(file))
+        return false;
+
+      file->buffer_offset = file->position;
+      file->buffer_size = 0;
+    }
+
+    const u32 offset = static_cast<u32>(file->position - file->buffer_offset);
+    const u32 size = std::min(remaining, FILE_BUFFER_SIZE - offset);
+    const u32 copied = ReadGuestMemory(address + done, &file->buffer[offset], size);
+    if (copied == 0)
+      break;
+
+    file->dirty_start = (file->dirty_start < file->dirty_end) ? std::min(file->dirty_start, offset) : offset;
+    file->dirty_end = std::max(file->dirty_end, offset + copied);
+    file->buffer_size = std::max(file->buffer_size, offset + copied);
+    file->position += copied;
+    file->bytes_written += copied;
+    done += copied;
+    if (copied != size)
+      break;
+  }
+
+  *written = done;
   return true;
 }
 
@@ -178,16 +407,25 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
         return true;
       }
 
-      s_files[handle] = FileSystem::OpenManagedCFile(filename.c_str(),
-                                                     is_open ? (g_settings.pcdrv_enable_writes ? "r+b" : "rb") : "w+b");
-      if (!s_files[handle])
+      FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(
+        filename.c_str(), is_open ? (g_settings.pcdrv_enable_writes ? "r+b" : "rb") : "w+b");
+      if (!fp)
       {
         ERROR_LOG("{}: Failed to open '{}'", func, filename);
         RETURN_ERROR();
         return true;
       }
 
+      // Buffering is done per handle, so there's no point having the C library copy everything a second time.
+      std::setvbuf(fp.get(), nullptr, _IONBF, 0);
+
+      s_files[handle] = std::make_unique<PCDrvFile>();
+      s_files[handle]->fp = std::move(fp);
+      s_files[handle]->buffer = std::make_unique<u8[]>(FILE_BUFFER_SIZE);
+      s_files[handle]->writable = (!is_open || g_settings.pcdrv_enable_writes);
+
       ERROR_LOG("PCDrv: Opened '{}' => {}", filename, handle);
+      s_files[handle]->path = std::move(filename);
       regs.v0 = 0;
       regs.v1 = static_cast<u32>(handle);
       return true;
@@ -212,37 +450,15 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
     {
       DEBUG_LOG("PCread({}, {}, 0x{:08X})", regs.a1, regs.a2, regs.a3);
 
-      std::FILE* fp = GetFileFromHandle(regs.a1);
-      if (!fp)
+      PCDrvFile* file = GetFileFromHandle(regs.a1);
+      if (!file || !ReadFile(file, regs.a3, regs.a2))
       {
         RETURN_ERROR();
         return true;
       }
 
-      const u32 count = regs.a2;
-      u32 dstaddr = regs.a3;
-      for (u32 i = 0; i < count; i++)
-      {
-        // Certainly less than optimal, but it's not like you're going to be reading megabytes of data here.
-        u8 val;
-        if (std::fread(&val, 1, 1, fp) != 1)
-        {
-          // Does not stop at EOF according to psx-spx.
-          if (std::ferror(fp) != 0)
-          {
-            RETURN_ERROR();
-            return true;
-          }
-
-          val = 0;
-        }
-
-        CPU::SafeWriteMemoryByte(dstaddr, val);
-        dstaddr++;
-      }
-
       regs.v0 = 0;
-      regs.v1 = count;
+      regs.v1 = regs.a2;
       return true;
     }
 
@@ -250,32 +466,14 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
     {
       DEBUG_LOG("PCwrite({}, {}, 0x{:08x})", regs.a1, regs.a2, regs.a3);
 
-      std::FILE* fp = GetFileFromHandle(regs.a1);
-      if (!fp)
+      PCDrvFile* file = GetFileFromHandle(regs.a1);
+      u32 written;
+      if (!file || !WriteFile(file, regs.a3, regs.a2, &written))
       {
         RETURN_ERROR();
         return true;
       }
 
-      const u32 count = regs.a2;
-      u32 srcaddr = regs.a3;
-      u32 written = 0;
-      for (u32 i = 0; i < count; i++)
-      {
-        u8 val;
-        if (!CPU::SafeReadMemoryByte(srcaddr, &val))
-          break;
-
-        if (std::fwrite(&val, 1, 1, fp) != 1)
-        {
-          RETURN_ERROR();
-          return true;
-        }
-
-        srcaddr++;
-        written++;
-      }
-
       regs.v0 = 0;
       regs.v1 = written;
       return true;
@@ -285,8 +483,8 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
     {
       DEBUG_LOG("PClseek({}, {}, {})", regs.a1, regs.a2, regs.a3);
 
-      std::FILE* fp = GetFileFromHandle(regs.a1);
-      if (!fp)
+      PCDrvFile* file = GetFileFromHandle(regs.a1);
+      if (!file)
       {
         RETURN_ERROR();
         return true;
@@ -294,32 +492,46 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
 
       const s32 offset = static_cast<s32>(regs.a2);
       const u32 mode = regs.a3;
-      int hmode;
+      s64 base;
       switch (mode)
       {
-        case 0:
-          hmode = SEEK_SET;
+        case 0: // SEEK_SET
+          base = 0;
           break;
-        case 1:
-          hmode = SEEK_CUR;
-          break;
-        case 2:
-          hmode = SEEK_END;
+        case 1: // SEEK_CUR
+          base = file->position;
           break;
+        case 2: // SEEK_END
+        {
+          // Unwritten data may extend the file.
+          base = FileSystem::FSize64(file->fp.get());
+          if (base < 0)
+          {
+            RETURN_ERROR();
+            return true;
+          }
+
+          if (file->dirty_start < file->dirty_end)
+            base = std::max(base, file->buffer_offset + file->dirty_end);
+        }
+        break;
         default:
           RETURN_ERROR();
           return true;
       }
 
-      if (FileSystem::FSeek64(fp, offset, hmode) != 0)
+      // Only the guest position changes, the buffer is kept in case the guest seeks back into it.
+      file->num_seeks++;
+      if ((base + offset) < 0)
       {
-        ERROR_LOG("FSeek for PCDrv failed: {} {}", offset, hmode);
+        ERROR_LOG("PClseek to negative offset: {} {}", offset, mode);
         RETURN_ERROR();
         return true;
       }
 
+      file->position = base + offset;
       regs.v0 = 0;
-      regs.v1 = static_cast<u32>(static_cast<s32>(FileSystem::FTell64(fp)));
+      regs.v1 = static_cast<u32>(static_cast<s32>(file->position));
       return true;
     }
 
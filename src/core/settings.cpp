@@ -147,6 +147,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   emulation_speed = si.GetFloatValue("Main", "EmulationSpeed", 1.0f);
   fast_forward_speed = si.GetFloatValue("Main", "FastForwardSpeed", 0.0f);
   turbo_speed = si.GetFloatValue("Main", "TurboSpeed", 0.0f);
+  turbo_uncapped = si.GetBoolValue("Main", "TurboUncapped", false);
   sync_to_host_refresh_rate = si.GetBoolValue("Main", "SyncToHostRefreshRate", false);
   increase_timer_resolution = si.GetBoolValue("Main", "IncreaseTimerResolution", true);
   inhibit_screensaver = si.GetBoolValue("Main", "InhibitScreensaver", true);
@@ -166,6 +167,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   rewind_enable = si.GetBoolValue("Main", "RewindEnable", false);
   rewind_save_frequency = si.GetFloatValue("Main", "RewindFrequency", 10.0f);
   rewind_save_slots = static_cast<u32>(si.GetIntValue("Main", "RewindSaveSlots", 10));
+  rewind_memory_budget_mb = si.GetUIntValue("Main", "RewindMemoryBudgetMB", 0u);
   runahead_frames = static_cast<u32>(si.GetIntValue("Main", "RunaheadFrameCount", 0));
 
   pine_enable = si.GetBoolValue("PINE", "Enabled", false);
@@ -183,6 +185,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   cpu_recompiler_memory_exceptions = si.GetBoolValue("CPU", "RecompilerMemoryExceptions", false);
   cpu_recompiler_block_linking = si.GetBoolValue("CPU", "RecompilerBlockLinking", true);
   cpu_recompiler_icache = si.GetBoolValue("CPU", "RecompilerICache", false);
+  cpu_idle_loop_skipping = si.GetBoolValue("CPU", "IdleLoopSkipping", true);
   cpu_fastmem_mode = ParseCPUFastmemMode(
                        si.GetStringValue("CPU", "FastmemMode", GetCPUFastmemModeName(DEFAULT_CPU_FASTMEM_MODE)).c_str())
                        .value_or(DEFAULT_CPU_FASTMEM_MODE);
@@ -202,6 +205,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   gpu_disable_raster_order_views = si.GetBoolValue("GPU", "DisableRasterOrderViews", false);
   gpu_per_sample_shading = si.GetBoolValue("GPU", "PerSampleShading", false);
   gpu_use_thread = si.GetBoolValue("GPU", "UseThread", true);
+  gpu_use_hardware_thread = si.GetBoolValue("GPU", "UseHardwareThread", false);
   gpu_use_software_renderer_for_readbacks = si.GetBoolValue("GPU", "UseSoftwareRendererForReadbacks", false);
   gpu_true_color = si.GetBoolValue("GPU", "TrueColor", true);
   gpu_debanding = si.GetBoolValue("GPU", "Debanding", false);
@@ -298,6 +302,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
   display_pre_frame_sleep_buffer =
     si.GetFloatValue("Display", "PreFrameSleepBuffer", DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER);
   display_skip_presenting_duplicate_frames = si.GetBoolValue("Display", "SkipPresentingDuplicateFrames", false);
+  display_auto_frame_skip = si.GetBoolValue("Display", "AutoFrameSkip", false);
   display_vsync = si.GetBoolValue("Display", "VSync", false);
   display_disable_mailbox_presentation = si.GetBoolValue("Display", "DisableMailboxPresentation", false);
   display_force_4_3_for_24bit = si.GetBoolValue("Display", "Force4_3For24Bit", false);
@@ -365,6 +370,8 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
 
   bios_tty_logging = si.GetBoolValue("BIOS", "TTYLogging", false);
   bios_patch_fast_boot = si.GetBoolValue("BIOS", "PatchFastBoot", DEFAULT_FAST_BOOT_VALUE);
+  bios_hle_memory_routines = si.GetBoolValue("BIOS", "HLEMemoryRoutines", false);
+  bios_boot_snapshot_cache = si.GetBoolValue("BIOS", "BootSnapshotCache", false);
 
   multitap_mode =
     ParseMultitapModeName(
@@ -448,6 +455,7 @@ void Settings::Load(SettingsInterface& si, SettingsInterface& controller_si)
     si.GetIntValue("TextureReplacements", "DumpVRAMWriteWidthThreshold", 128);
   texture_replacements.dump_vram_write_height_threshold =
     si.GetIntValue("TextureReplacements", "DumpVRAMWriteHeightThreshold", 128);
+  texture_replacements.memory_budget_mb = si.GetUIntValue("TextureReplacements", "MemoryBudgetMB", 0u);
 
 #ifdef __ANDROID__
   // Android users are incredibly silly and don't understand that stretch is in the aspect ratio list...
@@ -464,6 +472,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
   si.SetFloatValue("Main", "EmulationSpeed", emulation_speed);
   si.SetFloatValue("Main", "FastForwardSpeed", fast_forward_speed);
   si.SetFloatValue("Main", "TurboSpeed", turbo_speed);
+  si.SetBoolValue("Main", "TurboUncapped", turbo_uncapped);
 
   if (!ignore_base)
   {
@@ -487,6 +496,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
   si.SetBoolValue("Main", "RewindEnable", rewind_enable);
   si.SetFloatValue("Main", "RewindFrequency", rewind_save_frequency);
   si.SetIntValue("Main", "RewindSaveSlots", rewind_save_slots);
+  si.SetUIntValue("Main", "RewindMemoryBudgetMB", rewind_memory_budget_mb);
   si.SetIntValue("Main", "RunaheadFrameCount", runahead_frames);
 
   si.SetBoolValue("PINE", "Enabled", pine_enable);
@@ -499,6 +509,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
   si.SetBoolValue("CPU", "RecompilerMemoryExceptions", cpu_recompiler_memory_exceptions);
   si.SetBoolValue("CPU", "RecompilerBlockLinking", cpu_recompiler_block_linking);
   si.SetBoolValue("CPU", "RecompilerICache", cpu_recompiler_icache);
+  si.SetBoolValue("CPU", "IdleLoopSkipping", cpu_idle_loop_skipping);
   si.SetStringValue("CPU", "FastmemMode", GetCPUFastmemModeName(cpu_fastmem_mode));
 
   si.SetStringValue("GPU", "Renderer", GetRendererName(gpu_renderer));
@@ -520,6 +531,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
 
   si.SetBoolValue("GPU", "PerSampleShading", gpu_per_sample_shading);
   si.SetBoolValue("GPU", "UseThread", gpu_use_thread);
+  si.SetBoolValue("GPU", "UseHardwareThread", gpu_use_hardware_thread);
   si.SetBoolValue("GPU", "UseSoftwareRendererForReadbacks", gpu_use_software_renderer_for_readbacks);
   si.SetBoolValue("GPU", "TrueColor", gpu_true_color);
   si.SetBoolValue("GPU", "Debanding", gpu_debanding);
@@ -563,6 +575,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
   si.SetBoolValue("Display", "OptimalFramePacing", display_optimal_frame_pacing);
   si.SetBoolValue("Display", "PreFrameSleep", display_pre_frame_sleep);
   si.SetBoolValue("Display", "SkipPresentingDuplicateFrames", display_skip_presenting_duplicate_frames);
+  si.SetBoolValue("Display", "AutoFrameSkip", display_auto_frame_skip);
   si.SetFloatValue("Display", "PreFrameSleepBuffer", display_pre_frame_sleep_buffer);
   si.SetBoolValue("Display", "VSync", display_vsync);
   si.SetBoolValue("Display", "DisableMailboxPresentation", display_disable_mailbox_presentation);
@@ -627,6 +640,8 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
 
   si.SetBoolValue("BIOS", "TTYLogging", bios_tty_logging);
   si.SetBoolValue("BIOS", "PatchFastBoot", bios_patch_fast_boot);
+  si.SetBoolValue("BIOS", "HLEMemoryRoutines", bios_hle_memory_routines);
+  si.SetBoolValue("BIOS", "BootSnapshotCache", bios_boot_snapshot_cache);
 
   for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
   {
@@ -696,6 +711,7 @@ void Settings::Save(SettingsInterface& si, bool ignore_base) const
                  texture_replacements.dump_vram_write_width_threshold);
   si.SetIntValue("TextureReplacements", "DumpVRAMWriteHeightThreshold",
                  texture_replacements.dump_vram_write_height_threshold);
+  si.SetUIntValue("TextureReplacements", "MemoryBudgetMB", texture_replacements.memory_budget_mb);
 }
 
 void Settings::Clear(SettingsInterface& si)
@@ -70,12 +70,14 @@ struct Settings
   bool cpu_recompiler_memory_exceptions : 1 = false;
   bool cpu_recompiler_block_linking : 1 = true;
   bool cpu_recompiler_icache : 1 = false;
+  bool cpu_idle_loop_skipping : 1 = true;
   u32 cpu_overclock_numerator = 1;
   u32 cpu_overclock_denominator = 1;
 
   float emulation_speed = 1.0f;
   float fast_forward_speed = 0.0f;
   float turbo_speed = 0.0f;
+  bool turbo_uncapped : 1 = false;
   bool sync_to_host_refresh_rate : 1 = false;
   bool increase_timer_resolution : 1 = true;
   bool inhibit_screensaver : 1 = true;
@@ -97,6 +99,7 @@ struct Settings
   bool rewind_enable : 1 = false;
   float rewind_save_frequency = 10.0f;
   u32 rewind_save_slots = 10;
+  u32 rewind_memory_budget_mb = 0;
   u32 runahead_frames = 0;
   u16 pine_slot = DEFAULT_PINE_SLOT;
 
@@ -105,6 +108,7 @@ struct Settings
   u8 gpu_resolution_scale = 1;
   u8 gpu_multisamples = 1;
   bool gpu_use_thread : 1 = true;
+  bool gpu_use_hardware_thread : 1 = false;
   bool gpu_use_software_renderer_for_readbacks : 1 = false;
   bool gpu_use_debug_device : 1 = false;
   bool gpu_disable_shader_cache : 1 = false;
@@ -156,6 +160,7 @@ struct Settings
   bool display_optimal_frame_pacing : 1 = false;
   bool display_pre_frame_sleep : 1 = false;
   bool display_skip_presenting_duplicate_frames : 1 = false;
+  bool display_auto_frame_skip : 1 = false;
   bool display_vsync : 1 = false;
   bool display_disable_mailbox_presentation : 1 = true;
   bool display_force_4_3_for_24bit : 1 = false;
@@ -250,6 +255,7 @@ struct Settings
     bool dump_vram_write_force_alpha_channel : 1 = true;
     u32 dump_vram_write_width_threshold = 128;
     u32 dump_vram_write_height_threshold = 128;
+    u32 memory_budget_mb = 0;
 
     ALWAYS_INLINE bool AnyReplacementsEnabled() const { return enable_vram_write_replacements; }
 
@@ -261,6 +267,8 @@ struct Settings
 
   bool bios_tty_logging : 1 = false;
   bool bios_patch_fast_boot : 1 = DEFAULT_FAST_BOOT_VALUE;
+  bool bios_hle_memory_routines : 1 = false;
+  bool bios_boot_snapshot_cache : 1 = false;
   bool enable_8mb_ram : 1 = false;
 
   std::array<ControllerType, NUM_CONTROLLER_AND_CARD_PORTS> controller_types{};
@@ -415,10 +415,12 @@ struct SPUState
 
   std::unique_ptr<AudioStream> audio_stream;
   std::unique_ptr<AudioStream> null_audio_stream;
+  std::unique_ptr<WAVWriter> audio_dump_writer;
 
   s16 last_reverb_input[2];
   s32 last_reverb_output[2];
   bool audio_output_muted = false;
+  bool runahead_replay = false;
 
 #ifdef SPU_DUMP_ALL_VOICES
   // +1 for reverb output
@@ -519,6 +521,8 @@ void SPU::Shutdown()
     s_state.s_voice_dump_writers[i].reset();
 #endif
 
+  StopDumpingAudio();
+
   s_state.tick_event.Deactivate();
   s_state.transfer_event.Deactivate();
   s_state.audio_stream.reset();
@@ -1641,11 +1645,44 @@ void SPU::SetAudioOutputMuted(bool muted)
   s_state.audio_output_muted = muted;
 }
 
+void SPU::SetRunaheadReplay(bool replaying)
+{
+  s_state.runahead_replay = replaying;
+}
+
 AudioStream* SPU::GetOutputStream()
 {
   return s_state.audio_stream.get();
 }
 
+bool SPU::StartDumpingAudio(const char* path)
+{
+  StopDumpingAudio();
+
+  std::unique_ptr<WAVWriter> writer = std::make_unique<WAVWriter>();
+  if (!writer->Open(path, SAMPLE_RATE, 2))
+  {
+    ERROR_LOG("Failed to open audio dump file '{}'", path);
+    return false;
+  }
+
+  INFO_LOG("Dumping audio to '{}'", path);
+  s_state.audio_dump_writer = std::move(writer);
+  return true;
+}
+
+void SPU::StopDumpingAudio()
+{
+  if (!s_state.audio_dump_writer)
+    return;
+
+  // Include any samples up to the current point.
+  GeneratePendingSamples();
+
+  INFO_LOG("Dumped {} audio frames.", s_state.audio_dump_writer->GetNumFrames());
+  s_state.audio_dump_writer.reset();
+}
+
 void SPU::Voice::KeyOn()
 {
   current_address = regs.adpcm_start_address & ~u16(1);
@@ -2476,6 +2513,9 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
     }
 #endif
 
+    if (s_state.audio_dump_writer && !s_state.runahead_replay) [[unlikely]]
+      s_state.audio_dump_writer->WriteFrames(output_frame_start, frames_in_this_batch);
+
     output_stream->EndWrite(frames_in_this_batch);
     remaining_frames -= frames_in_this_batch;
   }
@@ -47,7 +47,14 @@ std::array<u8, RAM_SIZE>& GetWritableRAM();
 bool IsAudioOutputMuted();
 void SetAudioOutputMuted(bool muted);
 
+/// Set while runahead replays frames which have already been output, so they are not dumped twice.
+void SetRunaheadReplay(bool replaying);
+
 AudioStream* GetOutputStream();
 void RecreateOutputStream();
 
+/// Writes the mixed output to a WAV file, independent of the output stream. Used for offline rendering.
+bool StartDumpingAudio(const char* path);
+void StopDumpingAudio();
+
 }; // namespace SPU
@@ -12,6 +12,7 @@
 #include "cpu_core.h"
 #include "cpu_pgxp.h"
 #include "dma.h"
+#include "fingerprint_cache.h"
 #include "fullscreen_ui.h"
 #include "game_database.h"
 #include "game_list.h"
@@ -20,6 +21,7 @@
 #include "host.h"
 #include "host_interface_progress_callback.h"
 #include "imgui_overlays.h"
+#include "input_movie.h"
 #include "interrupt_controller.h"
 #include "mdec.h"
 #include "memory_card.h"
@@ -43,6 +45,7 @@
 #include "util/input_manager.h"
 #include "util/iso_reader.h"
 #include "util/media_capture.h"
+#include "util/memory_usage.h"
 #include "util/platform_misc.h"
 #include "util/postprocessing.h"
 #include "util/sockets.h"
@@ -170,6 +173,9 @@ static void ResetThrottler();
 
 /// Throttles the system, i.e. sleeps until it's time to execute the next frame.
 static void Throttle(Common::Timer::Value current_time);
+
+/// Decides whether the GPU should drop draws for the next frame, based on whether this frame missed its deadline.
+static void UpdateAutoFrameSkip(bool frame_late);
 static void UpdatePerformanceCounters();
 static void AccumulatePreFrameSleepTime();
 static void UpdatePreFrameSleepTime();
@@ -185,9 +191,9 @@ static void ResetControllers();
 static void UpdatePerGameMemoryCards();
 static std::unique_ptr<MemoryCard> GetMemoryCardForSlot(u32 slot, MemoryCardType type);
 static void UpdateMultitaps();
-
-/// Returns the maximum size of a save state, considering the current configuration.
-static size_t GetMaxSaveStateSize();
+static void UpdateInputMovie();
+static bool IsAudioOnlyMode();
+static std::string GetNewInputMoviePath();
 
 static std::string GetMediaPathFromSaveState(const char* path);
 static bool SaveUndoLoadState();
@@ -200,13 +206,25 @@ static bool LoadStateBufferFromFile(SaveStateBuffer* buffer, std::FILE* fp, Erro
                                     bool read_media_path, bool read_screenshot, bool read_data);
 static bool ReadAndDecompressStateData(std::FILE* fp, std::span<u8> dst, u32 file_offset, u32 compressed_size,
                                        SAVE_STATE_HEADER::CompressionType method, Error* error);
-static bool SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screenshot_size = 256);
+static bool SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screenshot_size = 256,
+                              bool include_state_data = true);
 static bool SaveStateBufferToFile(const SaveStateBuffer& buffer, std::FILE* fp, Error* error,
                                   SaveStateCompressionMode compression_mode);
 static u32 CompressAndWriteStateData(std::FILE* fp, std::span<const u8> src, SaveStateCompressionMode method,
                                      u32* header_type, Error* error);
+static bool CanStreamStateData(SaveStateCompressionMode method);
+static u32 StreamStateDataToFile(std::FILE* fp, SaveStateCompressionMode method, u32* header_type,
+                                 u32* uncompressed_size, Error* error);
 static bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state);
 
+static std::string GetBootSnapshotPath();
+static u32 GetBootSnapshotEntryPoint(CDImage* image);
+static void ResumeOrArmBootSnapshot(u32 entry_pc);
+static bool BootSnapshotBreakpointCallback(CPU::BreakpointType type, VirtualMemoryAddress pc,
+                                           VirtualMemoryAddress memaddr);
+static void CancelBootSnapshot();
+static void SaveBootSnapshot();
+
 static bool IsExecutionInterrupted();
 static void CheckForAndExitExecution();
 
@@ -229,9 +247,11 @@ static void PollDiscordPresence();
 } // namespace System
 
 static constexpr const float PERFORMANCE_COUNTER_UPDATE_INTERVAL = 1.0f;
+static constexpr const double UNCAPPED_TURBO_PRESENT_INTERVAL = 1.0;
 static constexpr const char FALLBACK_EXE_NAME[] = "PSX.EXE";
 static constexpr u32 MAX_SKIPPED_DUPLICATE_FRAME_COUNT = 2; // 20fps minimum
 static constexpr u32 MAX_SKIPPED_TIMEOUT_FRAME_COUNT = 1;   // 30fps minimum
+static constexpr u32 MAX_AUTO_SKIPPED_FRAME_COUNT = 3;      // 15fps minimum
 
 static std::unique_ptr<INISettingsInterface> s_game_settings_interface;
 static std::unique_ptr<INISettingsInterface> s_input_settings_interface;
@@ -270,7 +290,11 @@ static bool s_can_sync_to_host = false;
 static bool s_syncing_to_host = false;
 static bool s_syncing_to_host_with_vsync = false;
 static bool s_skip_presenting_duplicate_frames = false;
+static bool s_auto_frame_skip = false;
+static bool s_uncapped_turbo = false;
+static Common::Timer::Value s_uncapped_turbo_last_present_time = 0;
 static u32 s_skipped_frame_count = 0;
+static u32 s_auto_skipped_frame_count = 0;
 static u32 s_last_presented_internal_frame_number = 0;
 
 static float s_throttle_frequency = 0.0f;
@@ -315,6 +339,12 @@ static Threading::ThreadHandle s_cpu_thread_handle;
 
 static std::unique_ptr<CheatList> s_cheat_list;
 static std::unique_ptr<MediaCapture> s_media_capture;
+static std::unique_ptr<InputMovie> s_input_movie;
+
+// boot snapshot, saved once the boot executable is entered
+static std::string s_boot_snapshot_path;
+static VirtualMemoryAddress s_boot_snapshot_pc = 0;
+static bool s_boot_snapshot_pending = false;
 
 // temporary save state, created when loading, used to undo load state
 static std::optional<System::SaveStateBuffer> s_undo_load_state;
@@ -834,6 +864,10 @@ std::string System::GetGameHashId(GameHash hash)
 
 bool System::GetGameDetailsFromImage(CDImage* cdi, std::string* out_id, GameHash* out_hash)
 {
+  // Skip reading the executable if we've already identified this file.
+  if (FingerprintCache::GetGameDetails(cdi, out_id, out_hash))
+    return true;
+
   IsoReader iso;
   if (!iso.Open(cdi, 1))
   {
@@ -887,14 +921,13 @@ bool System::GetGameDetailsFromImage(CDImage* cdi, std::string* out_id, GameHash
     }
   }
 
-  if (out_id)
-  {
-    if (id.empty())
-      *out_id = GetGameHashId(hash);
-    else
-      *out_id = std::move(id);
-  }
+  if (id.empty())
+    id = GetGameHashId(hash);
+
+  FingerprintCache::SetGameDetails(cdi, id, hash);
 
+  if (out_id)
+    *out_id = std::move(id);
   if (out_hash)
     *out_hash = hash;
 
@@ -1256,6 +1289,11 @@ void System::LoadSettings(bool display_osd_messages)
   InputManager::ReloadBindings(controller_si, hotkey_si);
   WarnAboutUnsafeSettings();
 
+  MemoryUsage::SetBudget(MemoryUsage::Category::RewindStates,
+                         static_cast<size_t>(g_settings.rewind_memory_budget_mb) * 1048576);
+  MemoryUsage::SetBudget(MemoryUsage::Category::TextureReplacements,
+                         static_cast<size_t>(g_settings.texture_replacements.memory_budget_mb) * 1048576);
+
   // apply compatibility settings
   if (g_settings.apply_compatibility_settings && !s_running_game_serial.empty())
   {
@@ -1484,6 +1522,9 @@ void System::ResetSystem()
     ApplySettings(false);
   }
 
+  if (s_input_movie)
+    StopInputMovie();
+
   InternalReset();
 
   // Reset boot mode/reload BIOS if needed. Preserve exe/psf boot.
@@ -1772,6 +1813,13 @@ bool System::BootSystem(SystemBootParameters parameters, Error* error)
     return false;
   }
 
+  // Boot snapshots are taken at the entry point of the disc's executable, which we need to read before inserting it.
+  // An overridden executable isn't part of the snapshot key, so don't use the cache for those boots.
+  const u32 boot_snapshot_pc = (disc && boot_mode != BootMode::BootEXE && exe_override.empty() &&
+                                parameters.save_state.empty() && g_settings.bios_boot_snapshot_cache) ?
+                                 GetBootSnapshotEntryPoint(disc.get()) :
+                                 0;
+
   // Insert disc.
   if (disc)
     CDROM::InsertMedia(std::move(disc), disc_region);
@@ -1806,6 +1854,9 @@ bool System::BootSystem(SystemBootParameters parameters, Error* error)
   Host::OnSystemStarted();
   Host::OnIdleStateChanged();
 
+  if (boot_snapshot_pc != 0)
+    ResumeOrArmBootSnapshot(boot_snapshot_pc);
+
   // try to load the state, if it fails, bail out
   if (!parameters.save_state.empty() && !LoadState(parameters.save_state.c_str(), error, false))
   {
@@ -1930,9 +1981,15 @@ void System::DestroySystem()
   if (s_state == State::Shutdown)
     return;
 
+  MemoryUsage::LogReport();
+
   if (s_media_capture)
     StopMediaCapture();
 
+  if (s_input_movie)
+    StopInputMovie();
+
+  CancelBootSnapshot();
   s_undo_load_state.reset();
 
 #ifdef ENABLE_GDB_SERVER
@@ -2056,6 +2113,13 @@ void System::FrameDone()
 {
   s_frame_number++;
 
+  // Cheats can't be active during a movie, so RAM at the end of each frame only depends on the recorded input.
+  if (s_input_movie) [[unlikely]]
+    s_input_movie->EndFrame(XXH3_64bits(Bus::g_ram, Bus::g_ram_size));
+
+  if (s_boot_snapshot_pending) [[unlikely]]
+    SaveBootSnapshot();
+
   // Vertex buffer is shared, need to flush what we have.
   g_gpu->FlushRender();
 
@@ -2157,15 +2221,34 @@ void System::FrameDone()
   const bool is_unique_frame = (s_last_presented_internal_frame_number != s_internal_frame_number);
   s_last_presented_internal_frame_number = s_internal_frame_number;
 
-  const bool skip_this_frame = (((s_skip_presenting_duplicate_frames && !is_unique_frame &&
-                                  s_skipped_frame_count < MAX_SKIPPED_DUPLICATE_FRAME_COUNT) ||
-                                 (!s_optimal_frame_pacing && current_time > s_next_frame_time &&
-                                  s_skipped_frame_count < MAX_SKIPPED_TIMEOUT_FRAME_COUNT) ||
-                                 g_gpu_device->ShouldSkipPresentingFrame()) &&
-                                !s_syncing_to_host_with_vsync && !IsExecutionInterrupted());
+  // Frame skip needs to know if we missed the deadline before Throttle() moves it. Frames with dropped draws
+  // would only show stale VRAM, so there's no point presenting them.
+  const bool frame_late = (current_time > s_next_frame_time);
+  const bool frame_draws_skipped = g_gpu->IsSkippingDrawCommands();
+
+  bool skip_this_frame;
+  if (s_uncapped_turbo) [[unlikely]]
+  {
+    // Uncapped turbo only presents occasionally, so the window still shows progress.
+    skip_this_frame = (frame_draws_skipped ||
+                       Common::Timer::ConvertValueToSeconds(current_time - s_uncapped_turbo_last_present_time) <
+                         UNCAPPED_TURBO_PRESENT_INTERVAL);
+  }
+  else
+  {
+    skip_this_frame = ((frame_draws_skipped ||
+                        (s_skip_presenting_duplicate_frames && !is_unique_frame &&
+                         s_skipped_frame_count < MAX_SKIPPED_DUPLICATE_FRAME_COUNT) ||
+                        (!s_optimal_frame_pacing && current_time > s_next_frame_time &&
+                         s_skipped_frame_count < MAX_SKIPPED_TIMEOUT_FRAME_COUNT) ||
+                        g_gpu_device->ShouldSkipPresentingFrame()) &&
+                       !s_syncing_to_host_with_vsync && !IsExecutionInterrupted());
+  }
+
   if (!skip_this_frame)
   {
     s_skipped_frame_count = 0;
+    s_uncapped_turbo_last_present_time = current_time;
 
     const bool scheduled_present = (s_optimal_frame_pacing && s_throttler_enabled && !IsExecutionInterrupted());
     const GPUDevice::Features features = g_gpu_device->GetFeatures();
@@ -2200,6 +2283,9 @@ void System::FrameDone()
       Throttle(current_time);
   }
 
+  if (s_auto_frame_skip)
+    UpdateAutoFrameSkip(frame_late);
+
   // pre-frame sleep (input lag reduction)
   current_time = Common::Timer::GetCurrentValue();
   if (s_pre_frame_sleep)
@@ -2223,6 +2309,9 @@ void System::FrameDone()
     CheckForAndExitExecution();
   }
 
+  if (s_input_movie) [[unlikely]]
+    UpdateInputMovie();
+
   g_gpu->RestoreDeviceContext();
 
   // Update perf counters *after* throttling, we want to measure from start-of-frame
@@ -2231,6 +2320,17 @@ void System::FrameDone()
   System::UpdatePerformanceCounters();
 }
 
+void System::UpdateAutoFrameSkip(bool frame_late)
+{
+  // Only skip when we're behind (or running unthrottled), and always draw at least one of every few frames so the
+  // display keeps updating. Runahead and video capture need every frame rendered.
+  const bool skip = ((frame_late || !s_throttler_enabled) && s_runahead_frames == 0 &&
+                     s_auto_skipped_frame_count < MAX_AUTO_SKIPPED_FRAME_COUNT &&
+                     !(s_media_capture && s_media_capture->IsCapturingVideo()) && !IsExecutionInterrupted());
+  s_auto_skipped_frame_count = skip ? (s_auto_skipped_frame_count + 1) : 0;
+  g_gpu->SetSkipDrawCommands(skip || IsAudioOnlyMode());
+}
+
 void System::SetThrottleFrequency(float frequency)
 {
   if (s_throttle_frequency == frequency)
@@ -2382,9 +2482,16 @@ bool System::CreateGPU(GPURenderer renderer, bool is_switching, Error* error)
     }
   }
 
+  g_gpu->SetSkipDrawCommands(IsAudioOnlyMode());
   return true;
 }
 
+bool System::IsAudioOnlyMode()
+{
+  // PSFs have no video, only the CRTC timing for vblank interrupts matters.
+  return (s_boot_mode == BootMode::BootPSF);
+}
+
 bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state)
 {
   if (!sw.DoMarker("System"))
@@ -2637,6 +2744,9 @@ bool System::LoadState(const char* path, Error* error, bool save_undo_state)
     fmt::format(TRANSLATE_FS("OSDMessage", "Loading state from '{}'..."), Path::GetFileName(path)),
     Host::OSD_INFO_DURATION);
 
+  if (s_input_movie)
+    StopInputMovie();
+
   if (save_undo_state)
     SaveUndoLoadState();
 
@@ -2736,6 +2846,7 @@ bool System::LoadStateFromBuffer(const SaveStateBuffer& buffer, Error* error, bo
     UpdatePerGameMemoryCards();
 
   ClearMemorySaveStates();
+  CancelBootSnapshot();
 
   // Updating game/loading settings can turn on hardcore mode. Catch this.
   Achievements::DisableHardcoreMode();
@@ -2935,8 +3046,9 @@ bool System::SaveState(const char* path, Error* error, bool backup_existing_save
 
   Common::Timer save_timer;
 
+  // State data is serialized straight into the compressor when writing the file if the method supports it.
   SaveStateBuffer buffer;
-  if (!SaveStateToBuffer(&buffer, error, 256))
+  if (!SaveStateToBuffer(&buffer, error, 256, !CanStreamStateData(g_settings.save_state_compression)))
     return false;
 
   // TODO: Do this on a thread pool
@@ -2975,7 +3087,172 @@ bool System::SaveState(const char* path, Error* error, bool backup_existing_save
   return FileSystem::CommitAtomicRenamedFile(fp, error);
 }
 
-bool System::SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screenshot_size /* = 256 */)
+std::string System::GetBootSnapshotPath()
+{
+  // Anything which changes what the machine does before reaching the entry point has to be part of the key.
+  XXH64_state_t* state = XXH64_createState();
+  XXH64_reset(state, 0x426F6F74);
+  const auto hash_value = [state](const auto& value) { XXH64_update(state, &value, sizeof(value)); };
+  XXH64_update(state, s_bios_hash.data(), s_bios_hash.size());
+  XXH64_update(state, g_scm_hash_str, std::strlen(g_scm_hash_str));
+  hash_value(s_running_game_hash);
+  hash_value(SAVE_STATE_VERSION);
+  hash_value(s_region);
+  hash_value(s_boot_mode);
+  hash_value(g_settings.controller_types);
+  hash_value(g_settings.memory_card_types);
+  hash_value(g_settings.multitap_mode);
+  hash_value(g_settings.cpu_overclock_active ? g_settings.cpu_overclock_numerator : 1u);
+  hash_value(g_settings.cpu_overclock_active ? g_settings.cpu_overclock_denominator : 1u);
+  hash_value(static_cast<bool>(g_settings.cpu_recompiler_icache));
+  hash_value(static_cast<bool>(g_settings.enable_8mb_ram));
+  hash_value(static_cast<bool>(g_settings.bios_hle_memory_routines));
+  hash_value(static_cast<bool>(g_settings.cdrom_region_check));
+  hash_value(g_settings.cdrom_read_speedup);
+  hash_value(g_settings.cdrom_seek_speedup);
+  hash_value(g_settings.dma_max_slice_ticks);
+  hash_value(g_settings.dma_halt_ticks);
+  hash_value(g_settings.gpu_fifo_size);
+  hash_value(g_settings.gpu_max_run_ahead);
+  hash_value(g_settings.gpu_force_video_timing);
+  hash_value(static_cast<bool>(g_settings.gpu_widescreen_hack));
+  const u64 key = XXH64_digest(state);
+  XXH64_freeState(state);
+
+  return Path::Combine(EmuFolders::Cache,
+                       fmt::format("bootsnap_{}_{:016X}.sav", Path::SanitizeFileName(s_running_game_serial), key));
+}
+
+u32 System::GetBootSnapshotEntryPoint(CDImage* image)
+{
+  std::string exe_name;
+  std::vector<u8> exe_data;
+  BIOS::PSEXEHeader header;
+  if (!ReadExecutableFromImage(image, &exe_name, &exe_data) || exe_data.size() < sizeof(header))
+    return 0;
+
+  std::memcpy(&header, exe_data.data(), sizeof(header));
+  if (!BIOS::IsValidPSExeHeader(header, exe_data.size()))
+    return 0;
+
+  return header.initial_pc;
+}
+
+void System::ResumeOrArmBootSnapshot(u32 entry_pc)
+{
+  // Resuming is a state load, and cheats would be baked into the snapshot.
+  if (Achievements::IsHardcoreModeActive() || g_settings.enable_cheats || !CDROM::IsMediaPS1Disc())
+    return;
+
+  std::string path = GetBootSnapshotPath();
+  if (FileSystem::FileExists(path.c_str()))
+  {
+    Common::Timer load_timer;
+    Error error;
+    SaveStateBuffer buffer;
+    auto fp = FileSystem::OpenManagedCFile(path.c_str(), "rb", &error);
+    if (fp && LoadStateBufferFromFile(&buffer, fp.get(), &error, false, true, false, true))
+    {
+      // The key includes the game hash, so the disc may have moved since the snapshot was made.
+      buffer.media_path = CDROM::GetMediaFileName();
+      buffer.media_subimage_index = CDROM::GetMedia()->HasSubImages() ? CDROM::GetMedia()->GetCurrentSubImage() : 0;
+      if (LoadStateFromBuffer(buffer, &error, true))
+      {
+        INFO_LOG("Resumed from boot snapshot '{}' in {:.2f} msec.", Path::GetFileName(path),
+                 load_timer.GetTimeMilliseconds());
+        return;
+      }
+    }
+
+    WARNING_LOG("Failed to load boot snapshot '{}', booting normally: {}", Path::GetFileName(path),
+                error.GetDescription());
+    fp.reset();
+    FileSystem::DeleteFile(path.c_str());
+    InternalReset();
+  }
+
+  if (!CPU::AddBreakpointWithCallback(CPU::BreakpointType::Execute, entry_pc, &BootSnapshotBreakpointCallback))
+    return;
+
+  DEV_LOG("Saving boot snapshot at entry point 0x{:08X}.", entry_pc);
+  s_boot_snapshot_path = std::move(path);
+  s_boot_snapshot_pc = entry_pc;
+}
+
+bool System::BootSnapshotBreakpointCallback(CPU::BreakpointType type, VirtualMemoryAddress pc,
+                                            VirtualMemoryAddress memaddr)
+{
+  // Defer to the end of the frame, where state is normally saved. Returning false removes the breakpoint.
+  s_boot_snapshot_pc = 0;
+  s_boot_snapshot_pending = true;
+  return false;
+}
+
+void System::CancelBootSnapshot()
+{
+  if (s_boot_snapshot_pc != 0)
+  {
+    CPU::RemoveBreakpoint(CPU::BreakpointType::Execute, s_boot_snapshot_pc);
+    s_boot_snapshot_pc = 0;
+  }
+
+  s_boot_snapshot_pending = false;
+  s_boot_snapshot_path = {};
+}
+
+void System::SaveBootSnapshot()
+{
+  const std::string path = std::move(s_boot_snapshot_path);
+  s_boot_snapshot_pending = false;
+
+  // Settings changed since boot, the snapshot wouldn't match its key.
+  if (GetBootSnapshotPath() != path)
+  {
+    WARNING_LOG("Emulation settings changed during boot, not saving boot snapshot.");
+    return;
+  }
+
+  Common::Timer save_timer;
+  Error error;
+  SaveStateBuffer buffer;
+  if (!SaveStateToBuffer(&buffer, &error, 0, !CanStreamStateData(g_settings.save_state_compression)))
+  {
+    ERROR_LOG("Failed to create boot snapshot: {}", error.GetDescription());
+    return;
+  }
+
+  auto fp = FileSystem::CreateAtomicRenamedFile(path, &error);
+  if (!fp || !SaveStateBufferToFile(buffer, fp.get(), &error, g_settings.save_state_compression))
+  {
+    ERROR_LOG("Failed to write boot snapshot '{}': {}", Path::GetFileName(path), error.GetDescription());
+    if (fp)
+      FileSystem::DiscardAtomicRenamedFile(fp);
+    return;
+  }
+
+  if (!FileSystem::CommitAtomicRenamedFile(fp, &error))
+  {
+    ERROR_LOG("Failed to write boot snapshot '{}': {}", Path::GetFileName(path), error.GetDescription());
+    return;
+  }
+
+  INFO_LOG("Saved boot snapshot '{}' in {:.2f} msec.", Path::GetFileName(path), save_timer.GetTimeMilliseconds());
+
+  // Drop snapshots for this game made with different settings, they're unlikely to be used again.
+  FileSystem::FindResultsArray files;
+  FileSystem::FindFiles(
+    EmuFolders::Cache.c_str(),
+    fmt::format("bootsnap_{}_*.sav", Path::SanitizeFileName(s_running_game_serial)).c_str(),
+    FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES, &files);
+  for (const FILESYSTEM_FIND_DATA& fd : files)
+  {
+    if (fd.FileName != path)
+      FileSystem::DeleteFile(fd.FileName.c_str());
+  }
+}
+
+bool System::SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screenshot_size /* = 256 */,
+                               bool include_state_data /* = true */)
 {
   if (IsShutdown()) [[unlikely]]
   {
@@ -3007,6 +3284,7 @@ bool System::SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screen
     screenshot_draw_rect = screenshot_draw_rect.sub32(screenshot_display_rect.xyxy());
     screenshot_display_rect = screenshot_display_rect.sub32(screenshot_display_rect.xyxy());
     VERBOSE_LOG("Saving {}x{} screenshot for state", screenshot_width, screenshot_height);
+    g_gpu->SyncRenderer();
 
     std::vector<u32> screenshot_buffer;
     u32 screenshot_stride;
@@ -3041,6 +3319,12 @@ bool System::SaveStateToBuffer(SaveStateBuffer* buffer, Error* error, u32 screen
   }
 
   // write data
+  if (!include_state_data)
+  {
+    buffer->state_size = 0;
+    return true;
+  }
+
   if (buffer->state_data.empty())
     buffer->state_data.resize(GetMaxSaveStateSize());
 
@@ -3104,17 +3388,26 @@ bool System::SaveStateBufferToFile(const SaveStateBuffer& buffer, std::FILE* fp,
     file_position += header.screenshot_compressed_size;
   }
 
-  DebugAssert(buffer.state_size > 0);
   header.offset_to_data = file_position;
-  header.data_uncompressed_size = static_cast<u32>(buffer.state_size);
-  header.data_compressed_size = CompressAndWriteStateData(fp, buffer.state_data.cspan(0, buffer.state_size),
-                                                          compression, &header.data_compression_type, error);
+  if (buffer.state_size > 0)
+  {
+    header.data_uncompressed_size = static_cast<u32>(buffer.state_size);
+    header.data_compressed_size = CompressAndWriteStateData(fp, buffer.state_data.cspan(0, buffer.state_size),
+                                                            compression, &header.data_compression_type, error);
+  }
+  else
+  {
+    // Buffer was captured without state data, so serialize it directly into the file.
+    DebugAssert(CanStreamStateData(compression));
+    header.data_compressed_size =
+      StreamStateDataToFile(fp, compression, &header.data_compression_type, &header.data_uncompressed_size, error);
+  }
   if (header.data_compressed_size == 0)
     return false;
 
   INFO_LOG("Save state compression: screenshot {} => {} bytes, data {} => {} bytes",
            buffer.screenshot.GetPitch() * buffer.screenshot.GetHeight(), header.screenshot_compressed_size,
-           buffer.state_size, header.data_compressed_size);
+           header.data_uncompressed_size, header.data_compressed_size);
 
   if (!FileSystem::FSeek64(fp, 0, SEEK_SET, error))
     return false;
@@ -3199,6 +3492,94 @@ u32 System::CompressAndWriteStateData(std::FILE* fp, std::span<const u8> src, Sa
   return write_size;
 }
 
+bool System::CanStreamStateData(SaveStateCompressionMode method)
+{
+  return (method == SaveStateCompressionMode::Uncompressed ||
+          (method >= SaveStateCompressionMode::ZstLow && method <= SaveStateCompressionMode::ZstHigh));
+}
+
+u32 System::StreamStateDataToFile(std::FILE* fp, SaveStateCompressionMode method, u32* header_type,
+                                  u32* uncompressed_size, Error* error)
+{
+  // Small fields are batched into chunks, large blocks (RAM, VRAM, SPU RAM) are passed through as-is.
+  static constexpr size_t CHUNK_SIZE = 256 * 1024;
+
+  u32 write_size = 0;
+  const auto write_output = [fp, &write_size, error](const void* data, size_t size) {
+    if (std::fwrite(data, size, 1, fp) != 1) [[unlikely]]
+    {
+      Error::SetErrno(error, "fwrite() failed: ", errno);
+      return false;
+    }
+
+    write_size += static_cast<u32>(size);
+    return true;
+  };
+
+  using CStreamPtr = std::unique_ptr<ZSTD_CStream, void (*)(ZSTD_CStream*)>;
+  CStreamPtr cstream(nullptr, [](ZSTD_CStream* ptr) { ZSTD_freeCStream(ptr); });
+  DynamicHeapArray<u8> output_buffer;
+  const auto compress = [&cstream, &output_buffer, &write_output, error](std::span<const u8> data,
+                                                                         ZSTD_EndDirective directive) {
+    ZSTD_inBuffer inbuf = {data.data(), data.size(), 0};
+    for (;;)
+    {
+      ZSTD_outBuffer outbuf = {output_buffer.data(), output_buffer.size(), 0};
+      const size_t remaining = ZSTD_compressStream2(cstream.get(), &outbuf, &inbuf, directive);
+      if (ZSTD_isError(remaining)) [[unlikely]]
+      {
+        const char* errstr = ZSTD_getErrorString(ZSTD_getErrorCode(remaining));
+        Error::SetStringFmt(error, "ZSTD_compressStream2() failed: {}", errstr ? errstr : "<unknown>");
+        return false;
+      }
+
+      if (outbuf.pos > 0 && !write_output(outbuf.dst, outbuf.pos)) [[unlikely]]
+        return false;
+
+      if ((directive == ZSTD_e_end) ? (remaining == 0) : (inbuf.pos == inbuf.size))
+        return true;
+    }
+  };
+
+  StateWrapper::FlushCallback flush_callback;
+  if (method == SaveStateCompressionMode::Uncompressed)
+  {
+    *header_type = static_cast<u32>(SAVE_STATE_HEADER::CompressionType::None);
+    flush_callback = [&write_output](std::span<const u8> data) { return write_output(data.data(), data.size()); };
+  }
+  else
+  {
+    const int level =
+      ((method == SaveStateCompressionMode::ZstLow) ? 1 : ((method == SaveStateCompressionMode::ZstHigh) ? 19 : 0));
+    cstream.reset(ZSTD_createCStream());
+    if (!cstream || ZSTD_isError(ZSTD_CCtx_setParameter(cstream.get(), ZSTD_c_compressionLevel, level))) [[unlikely]]
+    {
+      Error::SetStringView(error, "Failed to create zstd compression stream.");
+      return 0;
+    }
+
+    output_buffer.resize(ZSTD_CStreamOutSize());
+    *header_type = static_cast<u32>(SAVE_STATE_HEADER::CompressionType::Zstandard);
+    flush_callback = [&compress](std::span<const u8> data) { return compress(data, ZSTD_e_continue); };
+  }
+
+  DynamicHeapArray<u8> chunk_buffer(CHUNK_SIZE);
+  g_gpu->RestoreDeviceContext();
+  StateWrapper sw(chunk_buffer.span(), std::move(flush_callback), SAVE_STATE_VERSION);
+  if (!DoState(sw, nullptr, false, false) || !sw.Flush())
+  {
+    if (error && !error->IsValid())
+      Error::SetStringView(error, "DoState() failed");
+    return 0;
+  }
+
+  if (cstream && !compress({}, ZSTD_e_end))
+    return 0;
+
+  *uncompressed_size = static_cast<u32>(sw.GetPosition());
+  return write_size;
+}
+
 float System::GetTargetSpeed()
 {
   return s_target_speed;
@@ -3285,6 +3666,11 @@ void System::UpdatePerformanceCounters()
   VERBOSE_LOG("FPS: {:.2f} VPS: {:.2f} CPU: {:.2f} GPU: {:.2f} Average: {:.2f}ms Min: {:.2f}ms Max: {:.2f}ms", s_fps,
               s_vps, s_cpu_thread_usage, s_gpu_usage, s_average_frame_time, s_minimum_frame_time, s_maximum_frame_time);
 
+  // Overlays aren't drawn in uncapped turbo, so log the achieved speed instead.
+  if (s_uncapped_turbo)
+    INFO_LOG("Uncapped turbo: {:.1f}% speed, {:.2f} VPS, {:.2f}ms average frame time", s_speed, s_vps,
+             s_average_frame_time);
+
   Host::OnPerformanceCountersUpdated();
 }
 
@@ -3361,18 +3747,21 @@ void System::UpdateSpeedLimiterState()
 {
   DebugAssert(IsValid());
 
+  s_uncapped_turbo = (s_turbo_enabled && g_settings.turbo_uncapped);
   s_target_speed = s_turbo_enabled ?
-                     g_settings.turbo_speed :
+                     (s_uncapped_turbo ? 0.0f : g_settings.turbo_speed) :
                      (s_fast_forward_enabled ? g_settings.fast_forward_speed : g_settings.emulation_speed);
   s_throttler_enabled = (s_target_speed != 0.0f);
   s_optimal_frame_pacing = (s_throttler_enabled && g_settings.display_optimal_frame_pacing);
   s_skip_presenting_duplicate_frames = s_throttler_enabled && g_settings.display_skip_presenting_duplicate_frames;
+  s_auto_frame_skip = g_settings.display_auto_frame_skip;
   s_pre_frame_sleep = s_optimal_frame_pacing && g_settings.display_pre_frame_sleep;
   s_can_sync_to_host = false;
   s_syncing_to_host = false;
   s_syncing_to_host_with_vsync = false;
 
-  if (g_settings.sync_to_host_refresh_rate)
+  // Nothing gets presented in audio-only mode, so vsync can't pace us.
+  if (g_settings.sync_to_host_refresh_rate && !IsAudioOnlyMode())
   {
     const float host_refresh_rate = g_gpu_device->GetWindowInfo().surface_refresh_rate;
     if (host_refresh_rate > 0.0f)
@@ -3398,13 +3787,24 @@ void System::UpdateSpeedLimiterState()
     }
   }
 
+  // Host vsync paces us, so there's no deadline to miss.
+  if (s_syncing_to_host_with_vsync)
+    s_auto_frame_skip = false;
+  if (!s_auto_frame_skip)
+  {
+    s_auto_skipped_frame_count = 0;
+    g_gpu->SetSkipDrawCommands(IsAudioOnlyMode());
+  }
+
   VERBOSE_LOG("Target speed: {}%", s_target_speed * 100.0f);
   VERBOSE_LOG("Preset timing: {}", s_optimal_frame_pacing ? "consistent" : "immediate");
 
-  // Update audio output.
+  // Update audio output. Uncapped turbo sends samples to the null stream, skipping stretching/resampling.
   AudioStream* stream = SPU::GetOutputStream();
   stream->SetOutputVolume(GetAudioOutputVolume());
   stream->SetNominalRate(GetAudioNominalRate());
+  if (s_runahead_replay_frames == 0)
+    SPU::SetAudioOutputMuted(s_uncapped_turbo);
 
   UpdateThrottlePeriod();
   ResetThrottler();
@@ -4056,7 +4456,11 @@ void System::UpdateRunningGame(const std::string_view path, CDImage* image, bool
   }
 
   if (!booting)
+  {
+    // Replacement lookups may be running on the GPU thread.
+    g_gpu->SyncRenderer();
     TextureReplacements::SetGameID(s_running_game_serial);
+  }
 
   if (booting)
     Achievements::ResetHardcoreMode(true);
@@ -4317,7 +4721,9 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         (g_settings.cpu_recompiler_memory_exceptions != old_settings.cpu_recompiler_memory_exceptions ||
          g_settings.cpu_recompiler_block_linking != old_settings.cpu_recompiler_block_linking ||
          g_settings.cpu_recompiler_icache != old_settings.cpu_recompiler_icache ||
-         g_settings.bios_tty_logging != old_settings.bios_tty_logging))
+         g_settings.cpu_idle_loop_skipping != old_settings.cpu_idle_loop_skipping ||
+         g_settings.bios_tty_logging != old_settings.bios_tty_logging ||
+         g_settings.bios_hle_memory_routines != old_settings.bios_hle_memory_routines))
     {
       Host::AddIconOSDMessage("CPUFlushAllBlocks", ICON_FA_MICROCHIP,
                               TRANSLATE_STR("OSDMessage", "Recompiler options changed, flushing all blocks."),
@@ -4326,9 +4732,10 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
       CPU::g_state.bus_error = false;
     }
     else if (g_settings.cpu_execution_mode == CPUExecutionMode::Interpreter &&
-             g_settings.bios_tty_logging != old_settings.bios_tty_logging)
+             (g_settings.bios_tty_logging != old_settings.bios_tty_logging ||
+              g_settings.bios_hle_memory_routines != old_settings.bios_hle_memory_routines))
     {
-      // TTY interception requires debug dispatcher.
+      // TTY and HLE interception requires debug dispatcher.
       if (CPU::UpdateDebugDispatcherFlag())
         InterruptExecution();
     }
@@ -4342,9 +4749,15 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     if (g_settings.enable_cheats != old_settings.enable_cheats)
     {
       if (g_settings.enable_cheats)
+      {
+        // Cheat writes aren't part of the recording, so the movie would desync.
+        StopInputMovie();
         LoadCheatList();
+      }
       else
+      {
         SetCheatList(nullptr);
+      }
     }
 
     SPU::GetOutputStream()->SetOutputVolume(GetAudioOutputVolume());
@@ -4353,6 +4766,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         g_settings.gpu_multisamples != old_settings.gpu_multisamples ||
         g_settings.gpu_per_sample_shading != old_settings.gpu_per_sample_shading ||
         g_settings.gpu_use_thread != old_settings.gpu_use_thread ||
+        g_settings.gpu_use_hardware_thread != old_settings.gpu_use_hardware_thread ||
         g_settings.gpu_use_software_renderer_for_readbacks != old_settings.gpu_use_software_renderer_for_readbacks ||
         g_settings.gpu_fifo_size != old_settings.gpu_fifo_size ||
         g_settings.gpu_max_run_ahead != old_settings.gpu_max_run_ahead ||
@@ -4429,6 +4843,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     if (g_settings.rewind_enable != old_settings.rewind_enable ||
         g_settings.rewind_save_frequency != old_settings.rewind_save_frequency ||
         g_settings.rewind_save_slots != old_settings.rewind_save_slots ||
+        g_settings.rewind_memory_budget_mb != old_settings.rewind_memory_budget_mb ||
         g_settings.runahead_frames != old_settings.runahead_frames)
     {
       UpdateMemorySaveStateSettings();
@@ -4438,6 +4853,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
           old_settings.texture_replacements.enable_vram_write_replacements ||
         g_settings.texture_replacements.preload_textures != old_settings.texture_replacements.preload_textures)
     {
+      g_gpu->SyncRenderer();
       TextureReplacements::Reload();
     }
 
@@ -4445,8 +4861,10 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         g_settings.increase_timer_resolution != old_settings.increase_timer_resolution ||
         g_settings.emulation_speed != old_settings.emulation_speed ||
         g_settings.fast_forward_speed != old_settings.fast_forward_speed ||
+        g_settings.turbo_uncapped != old_settings.turbo_uncapped ||
         g_settings.display_optimal_frame_pacing != old_settings.display_optimal_frame_pacing ||
         g_settings.display_skip_presenting_duplicate_frames != old_settings.display_skip_presenting_duplicate_frames ||
+        g_settings.display_auto_frame_skip != old_settings.display_auto_frame_skip ||
         g_settings.display_pre_frame_sleep != old_settings.display_pre_frame_sleep ||
         g_settings.display_pre_frame_sleep_buffer != old_settings.display_pre_frame_sleep_buffer ||
         g_settings.display_vsync != old_settings.display_vsync ||
@@ -4726,6 +5144,8 @@ void System::ClearMemorySaveStates()
 {
   s_rewind_states.clear();
   s_runahead_states.clear();
+  MemoryUsage::Set(MemoryUsage::Category::RewindStates, 0);
+  MemoryUsage::Set(MemoryUsage::Category::RunaheadStates, 0);
 }
 
 void System::UpdateMemorySaveStateSettings()
@@ -4756,6 +5176,7 @@ void System::UpdateMemorySaveStateSettings()
 
   s_runahead_frames = g_settings.runahead_frames;
   s_runahead_replay_pending = false;
+  SPU::SetRunaheadReplay(false);
   if (s_runahead_frames > 0)
     INFO_LOG("Runahead is active with {} frames", s_runahead_frames);
 }
@@ -4802,18 +5223,22 @@ bool System::SaveRewindState()
   Common::Timer save_timer;
 #endif
 
-  // try to reuse the frontmost slot
+  // try to reuse the frontmost slot, dropping extra states if we're over the memory budget
   const u32 save_slots = g_settings.rewind_save_slots;
   MemorySaveState mss;
-  while (s_rewind_states.size() >= save_slots)
+  while (!s_rewind_states.empty() &&
+         (s_rewind_states.size() >= save_slots ||
+          MemoryUsage::WouldExceedBudget(MemoryUsage::Category::RewindStates, GetMaxSaveStateSize())))
   {
     mss = std::move(s_rewind_states.front());
     s_rewind_states.pop_front();
+    MemoryUsage::Remove(MemoryUsage::Category::RewindStates, static_cast<s64>(mss.state_data.size()));
   }
 
   if (!SaveMemoryState(&mss))
     return false;
 
+  MemoryUsage::Add(MemoryUsage::Category::RewindStates, static_cast<s64>(mss.state_data.size()));
   s_rewind_states.push_back(std::move(mss));
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
@@ -4829,6 +5254,8 @@ bool System::LoadRewindState(u32 skip_saves /*= 0*/, bool consume_state /*=true
   while (skip_saves > 0 && !s_rewind_states.empty())
   {
     g_gpu_device->RecycleTexture(std::move(s_rewind_states.back().vram_texture));
+    MemoryUsage::Remove(MemoryUsage::Category::RewindStates,
+                        static_cast<s64>(s_rewind_states.back().state_data.size()));
     s_rewind_states.pop_back();
     skip_saves--;
   }
@@ -4844,7 +5271,11 @@ bool System::LoadRewindState(u32 skip_saves /*= 0*/, bool consume_state /*=true
     return false;
 
   if (consume_state)
+  {
+    MemoryUsage::Remove(MemoryUsage::Category::RewindStates,
+                        static_cast<s64>(s_rewind_states.back().state_data.size()));
     s_rewind_states.pop_back();
+  }
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
   DEV_LOG("Rewind load took {:.4f} ms", load_timer.GetTimeMilliseconds());
@@ -4863,6 +5294,8 @@ void System::SetRewinding(bool enabled)
   if (enabled)
   {
     const bool was_enabled = IsRewinding();
+    if (s_input_movie)
+      StopInputMovie();
 
     // Try to rewind at the replay speed, or one per second maximum.
     const float load_frequency = std::min(g_settings.rewind_save_frequency, 1.0f);
@@ -4910,6 +5343,7 @@ void System::SaveRunaheadState()
   {
     mss = std::move(s_runahead_states.front());
     s_runahead_states.pop_front();
+    MemoryUsage::Remove(MemoryUsage::Category::RunaheadStates, static_cast<s64>(mss.state_data.size()));
   }
 
   if (!SaveMemoryState(&mss))
@@ -4918,6 +5352,7 @@ void System::SaveRunaheadState()
     return;
   }
 
+  MemoryUsage::Add(MemoryUsage::Category::RunaheadStates, static_cast<s64>(mss.state_data.size()));
   s_runahead_states.push_back(std::move(mss));
 }
 
@@ -4939,6 +5374,7 @@ bool System::DoRunahead()
     if (s_runahead_states.empty() || !LoadMemoryState(s_runahead_states.front()))
     {
       s_runahead_states.clear();
+      MemoryUsage::Set(MemoryUsage::Category::RunaheadStates, 0);
       return false;
     }
 
@@ -4947,9 +5383,11 @@ bool System::DoRunahead()
 
     // and throw away all the states, forcing us to catch up below
     s_runahead_states.clear();
+    MemoryUsage::Set(MemoryUsage::Category::RunaheadStates, 0);
 
     // run the frames with no audio
     SPU::SetAudioOutputMuted(true);
+    SPU::SetRunaheadReplay(true);
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
     VERBOSE_LOG("Rewound to frame {}, took {:.2f} ms", s_frame_number, replay_timer.GetTimeMilliseconds());
@@ -4979,7 +5417,8 @@ bool System::DoRunahead()
 #endif
 
   // we're all caught up. this frame gets saved in DoMemoryStates().
-  SPU::SetAudioOutputMuted(false);
+  SPU::SetAudioOutputMuted(s_uncapped_turbo);
+  SPU::SetRunaheadReplay(false);
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
   DEV_LOG("runahead ending at frame {}, took {:.2f} ms", s_frame_number, replay_timer.GetTimeMilliseconds());
@@ -5135,6 +5574,7 @@ bool System::SaveScreenshot(const char* filename, DisplayScreenshotMode mode, Di
     filename = auto_filename.c_str();
   }
 
+  g_gpu->SyncRenderer();
   return g_gpu->RenderScreenshotToFile(filename, mode, quality, compress_on_thread, true);
 }
 
@@ -5288,6 +5728,172 @@ void System::StopMediaCapture()
   Host::OnMediaCaptureStopped();
 }
 
+InputMovie* System::GetInputMovie()
+{
+  return s_input_movie.get();
+}
+
+std::string System::GetNewInputMoviePath()
+{
+  const std::string sanitized_name = Path::SanitizeFileName(GetGameTitle());
+  if (sanitized_name.empty())
+    return Path::Combine(EmuFolders::Dumps, fmt::format("{}.dsm", GetTimestampStringForFileName()));
+  else
+    return Path::Combine(EmuFolders::Dumps, fmt::format("{} {}.dsm", sanitized_name, GetTimestampStringForFileName()));
+}
+
+bool System::StartInputMovieRecording(std::string path, Error* error)
+{
+  if (!IsValid())
+  {
+    Error::SetStringView(error, "System is not booted.");
+    return false;
+  }
+  else if (s_runahead_frames > 0)
+  {
+    Error::SetStringView(error, "Input movies cannot be used with runahead.");
+    return false;
+  }
+  else if (g_settings.enable_cheats)
+  {
+    Error::SetStringView(error, "Input movies cannot be used with cheats enabled.");
+    return false;
+  }
+
+  if (s_input_movie)
+    StopInputMovie();
+
+  if (path.empty())
+    path = GetNewInputMoviePath();
+
+  SaveStateBuffer buffer;
+  if (!SaveStateToBuffer(&buffer, error, 0))
+    return false;
+
+  buffer.state_data.resize(buffer.state_size);
+  s_input_movie = InputMovie::CreateRecording(std::move(path), s_running_game_serial, buffer.version,
+                                              std::move(buffer.state_data));
+  s_input_movie->BeginFrame();
+
+  Host::AddIconOSDMessage("InputMovie", ICON_FA_FILM,
+                          fmt::format(TRANSLATE_FS("System", "Recording input movie to '{}'."),
+                                      Path::GetFileName(s_input_movie->GetPath())),
+                          Host::OSD_INFO_DURATION);
+  return true;
+}
+
+bool System::StartInputMoviePlayback(const char* path, Error* error)
+{
+  if (!IsValid())
+  {
+    Error::SetStringView(error, "System is not booted.");
+    return false;
+  }
+  else if (s_runahead_frames > 0)
+  {
+    Error::SetStringView(error, "Input movies cannot be used with runahead.");
+    return false;
+  }
+  else if (g_settings.enable_cheats)
+  {
+    Error::SetStringView(error, "Input movies cannot be used with cheats enabled.");
+    return false;
+  }
+
+  std::unique_ptr<InputMovie> movie = InputMovie::OpenPlayback(path, error);
+  if (!movie)
+    return false;
+
+  if (movie->GetSerial() != s_running_game_serial)
+  {
+    Error::SetStringFmt(error, "Input movie was recorded with '{}', but '{}' is running.", movie->GetSerial(),
+                        s_running_game_serial);
+    return false;
+  }
+
+  if (s_input_movie)
+    StopInputMovie();
+
+  // Load the start state on top of the running media.
+  SaveStateBuffer buffer;
+  buffer.serial = s_running_game_serial;
+  buffer.title = s_running_game_title;
+  buffer.media_subimage_index = 0;
+  if (CDROM::HasMedia())
+  {
+    buffer.media_path = CDROM::GetMediaFileName();
+    buffer.media_subimage_index = CDROM::GetMedia()->HasSubImages() ? CDROM::GetMedia()->GetCurrentSubImage() : 0;
+  }
+  buffer.version = movie->GetStateVersion();
+  buffer.state_size = movie->GetStartState().size();
+  buffer.state_data = std::move(movie->GetStartState());
+  if (!LoadStateFromBuffer(buffer, error, true))
+    return false;
+
+  s_input_movie = std::move(movie);
+  s_input_movie->BeginFrame();
+
+  Host::AddIconOSDMessage("InputMovie", ICON_FA_FILM,
+                          fmt::format(TRANSLATE_FS("System", "Playing input movie '{}' ({} frames)."),
+                                      Path::GetFileName(s_input_movie->GetPath()), s_input_movie->GetFrameCount()),
+                          Host::OSD_INFO_DURATION);
+  return true;
+}
+
+void System::StopInputMovie()
+{
+  if (!s_input_movie)
+    return;
+
+  const std::unique_ptr<InputMovie> movie = std::move(s_input_movie);
+  if (movie->IsRecording())
+  {
+    Error error;
+    if (movie->Save(&error))
+    {
+      INFO_LOG("Saved input movie with {} frames to '{}'.", movie->GetFrameCount(), movie->GetPath());
+      Host::AddIconOSDMessage("InputMovie", ICON_FA_FILM,
+                              fmt::format(TRANSLATE_FS("System", "Saved input movie with {} frames to '{}'."),
+                                          movie->GetFrameCount(), Path::GetFileName(movie->GetPath())),
+                              Host::OSD_INFO_DURATION);
+    }
+    else
+    {
+      Host::AddIconOSDWarning(
+        "InputMovie", ICON_FA_EXCLAMATION_TRIANGLE,
+        fmt::format(TRANSLATE_FS("System", "Failed to save input movie: {}"), error.GetDescription()),
+        Host::OSD_ERROR_DURATION);
+    }
+  }
+  else if (movie->HasDesynced())
+  {
+    Host::AddIconOSDWarning(
+      "InputMovie", ICON_FA_EXCLAMATION_TRIANGLE,
+      fmt::format(TRANSLATE_FS("System", "Input movie desynced at frame {}."), movie->GetCurrentFrame()),
+      Host::OSD_ERROR_DURATION);
+  }
+  else
+  {
+    Host::AddIconOSDMessage("InputMovie", ICON_FA_FILM,
+                            fmt::format(TRANSLATE_FS("System", "Input movie playback stopped after {} of {} frames."),
+                                        movie->GetCurrentFrame(), movie->GetFrameCount()),
+                            Host::OSD_INFO_DURATION);
+  }
+}
+
+void System::UpdateInputMovie()
+{
+  // Stop playback once it can no longer drive the game. Checked here rather than at the end of the frame, so
+  // hosts see the final state from FrameDone().
+  if (s_input_movie->IsPlayback() && (s_input_movie->HasDesynced() || s_input_movie->IsPlaybackFinished()))
+  {
+    StopInputMovie();
+    return;
+  }
+
+  s_input_movie->BeginFrame();
+}
+
 std::string System::GetGameSaveStateFileName(std::string_view serial, s32 slot)
 {
   if (slot < 0)
@@ -5764,6 +6370,10 @@ bool System::PresentDisplay(bool explicit_present, u64 present_time)
   // acquire for IO.MousePos.
   std::atomic_thread_fence(std::memory_order_acquire);
 
+  // UI rendering can create textures, so the GPU thread has to be finished with the device first.
+  if (g_gpu)
+    g_gpu->SyncRenderer();
+
   FullscreenUI::Render();
   ImGuiManager::RenderTextOverlays();
   ImGuiManager::RenderOSDMessages();
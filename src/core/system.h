@@ -27,6 +27,7 @@ struct CheatCode;
 class CheatList;
 
 class GPUTexture;
+class InputMovie;
 class MediaCapture;
 
 namespace BIOS {
@@ -259,6 +260,9 @@ bool LoadState(const char* path, Error* error, bool save_undo_state);
 bool SaveState(const char* path, Error* error, bool backup_existing_save);
 bool SaveResumeState(Error* error);
 
+/// Returns the maximum size of a save state, considering the current configuration.
+size_t GetMaxSaveStateSize();
+
 /// Runs the VM until the CPU execution is canceled.
 void Execute();
 
@@ -406,6 +410,18 @@ void StopMediaCapture();
 
 #endif
 
+/// Current input movie (if recording or playing back).
+InputMovie* GetInputMovie();
+
+/// Records controller input from the current frame onwards. If no path is provided, one will be generated.
+bool StartInputMovieRecording(std::string path, Error* error);
+
+/// Loads the movie's start state and replays its input. The running game must match the recording.
+bool StartInputMoviePlayback(const char* path, Error* error);
+
+/// Stops playback, or saves the recording.
+void StopInputMovie();
+
 /// Loads the cheat list for the current game title from the user directory.
 bool LoadCheatList();
 
@@ -6,6 +6,8 @@
 #include "host.h"
 #include "settings.h"
 
+#include "util/memory_usage.h"
+
 #include "common/bitutils.h"
 #include "common/file_system.h"
 #include "common/hash_combine.h"
@@ -62,13 +64,13 @@ static std::string GetVRAMWriteDumpFilename(u32 width, u32 height, const void* p
 
 static void FindTextures(const std::string& dir);
 
-static const ReplacementImage* LoadTexture(const std::string& filename);
+static const ReplacementImage* LoadTexture(const std::string& filename, bool* over_budget = nullptr);
 static void PreloadTextures();
 static void PurgeUnreferencedTexturesFromCache();
+static void UpdateTextureCacheMemoryUsage();
 
 static std::string s_game_id;
 
-// TODO: Check the size, purge some when it gets too large.
 static TextureCache s_texture_cache;
 
 static VRAMWriteReplacementMap s_vram_write_replacements;
@@ -161,6 +163,7 @@ void TextureReplacements::Shutdown()
   s_texture_cache.clear();
   s_vram_write_replacements.clear();
   s_game_id.clear();
+  UpdateTextureCacheMemoryUsage();
 }
 
 // TODO: Organize into PCSX2-style.
@@ -226,6 +229,17 @@ void TextureReplacements::PurgeUnreferencedTexturesFromCache()
       old_map.erase(it2);
     }
   }
+
+  UpdateTextureCacheMemoryUsage();
+}
+
+void TextureReplacements::UpdateTextureCacheMemoryUsage()
+{
+  size_t size = 0;
+  for (const auto& it : s_texture_cache)
+    size += static_cast<size_t>(it.second.GetPitch()) * it.second.GetHeight();
+
+  MemoryUsage::Set(MemoryUsage::Category::TextureReplacements, size);
 }
 
 bool TextureReplacements::ParseReplacementFilename(const std::string& filename, VRAMReplacementHash* replacement_hash,
@@ -289,8 +303,12 @@ void TextureReplacements::FindTextures(const std::string& dir)
   INFO_LOG("Found {} replacement VRAM writes for '{}'", s_vram_write_replacements.size(), s_game_id);
 }
 
-const TextureReplacements::ReplacementImage* TextureReplacements::LoadTexture(const std::string& filename)
+const TextureReplacements::ReplacementImage* TextureReplacements::LoadTexture(const std::string& filename,
+                                                                             bool* over_budget)
 {
+  if (over_budget)
+    *over_budget = false;
+
   auto it = s_texture_cache.find(filename);
   if (it != s_texture_cache.end())
     return &it->second;
@@ -303,7 +321,28 @@ const TextureReplacements::ReplacementImage* TextureReplacements::LoadTexture(co
   }
 
   INFO_LOG("Loaded '{}': {}x{}", Path::GetFileName(filename), image.GetWidth(), image.GetHeight());
+
+  // When preloading, evicting would only throw away textures we just loaded, so report it to the caller instead.
+  const size_t image_size = static_cast<size_t>(image.GetPitch()) * image.GetHeight();
+  if (over_budget && MemoryUsage::WouldExceedBudget(MemoryUsage::Category::TextureReplacements, image_size))
+  {
+    *over_budget = true;
+    return nullptr;
+  }
+
+  // Textures are reloaded from disk if they're needed again, so it doesn't matter which ones go.
+  while (!s_texture_cache.empty() &&
+         MemoryUsage::WouldExceedBudget(MemoryUsage::Category::TextureReplacements, image_size))
+  {
+    const auto evict_it = s_texture_cache.begin();
+    DEV_LOG("Evicting '{}' from replacement cache", Path::GetFileName(evict_it->first));
+    MemoryUsage::Remove(MemoryUsage::Category::TextureReplacements,
+                        static_cast<s64>(evict_it->second.GetPitch()) * evict_it->second.GetHeight());
+    s_texture_cache.erase(evict_it);
+  }
+
   it = s_texture_cache.emplace(filename, std::move(image)).first;
+  MemoryUsage::Add(MemoryUsage::Category::TextureReplacements, static_cast<s64>(image_size));
   return &it->second;
 }
 
@@ -327,7 +366,15 @@ void TextureReplacements::PreloadTextures()
   {
     UPDATE_PROGRESS();
 
-    LoadTexture(it.second);
+    bool over_budget;
+    LoadTexture(it.second, &over_budget);
+    if (over_budget)
+    {
+      WARNING_LOG("Replacement texture memory budget reached, stopping preload after {} of {} textures.",
+                  num_textures_loaded, total_textures);
+      break;
+    }
+
     num_textures_loaded++;
   }
 
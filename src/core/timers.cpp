@@ -67,7 +67,10 @@ static void UpdateCountingEnabled(CounterState& cs);
 static void CheckForIRQ(u32 index, u32 old_counter);
 
 static void AddSysClkTicks(void*, TickCount sysclk_ticks, TickCount ticks_late);
+static void AddSysClkTicksToCounters(TickCount sysclk_ticks);
+static void SynchronizeSysClk();
 
+static bool HasIRQEnabled(const CounterState& cs);
 static TickCount GetTicksUntilNextInterrupt();
 static void UpdateSysClkEvent();
 
@@ -77,9 +80,13 @@ struct TimersState
   TimingEvent sysclk_event{ "Timer SysClk Interrupt", 1, 1, &Timers::AddSysClkTicks, nullptr };
 
   std::array<CounterState, NUM_TIMERS> counters{};
-  TickCount sysclk_ticks_carry = 0; // 0 unless overclocking is enabled
-  u32 sysclk_div_8_carry = 0;       // partial ticks for timer 3 with sysclk/8
+  TickCount sysclk_ticks_carry = 0;   // 0 unless overclocking is enabled
+  u32 sysclk_div_8_carry = 0;         // partial ticks for timer 3 with sysclk/8
+  TickCount sysclk_ticks_applied = 0; // ticks since the event last ran that were already added on register access
 };
+
+// Without any timer IRQs, the event only has to run often enough that the elapsed time can't overflow.
+static constexpr TickCount IDLE_SYSCLK_EVENT_TICKS = 0x40000000;
 } // namespace
 
 ALIGN_TO_CACHE_LINE static TimersState s_state;
@@ -112,6 +119,7 @@ void Timers::Reset()
   s_state.sysclk_event.Deactivate();
   s_state.sysclk_ticks_carry = 0;
   s_state.sysclk_div_8_carry = 0;
+  s_state.sysclk_ticks_applied = 0;
   UpdateSysClkEvent();
 }
 
@@ -132,6 +140,11 @@ bool Timers::DoState(StateWrapper& sw)
   sw.Do(&s_state.sysclk_ticks_carry);
   sw.Do(&s_state.sysclk_div_8_carry);
 
+  if (sw.GetVersion() >= 73) [[likely]]
+    sw.Do(&s_state.sysclk_ticks_applied);
+  else
+    s_state.sysclk_ticks_applied = 0;
+
   if (sw.IsReading())
     UpdateSysClkEvent();
 
@@ -173,7 +186,7 @@ void Timers::SetGate(u32 timer, bool state)
   // Because the gate prevents counting in or outside of the gate, we need a correct counter.
   // For reset, we _can_ skip it, until the gate clears.
   if (!cs.use_external_clock && (cs.mode.sync_mode != SyncMode::ResetOnGateEnd || !state))
-    s_state.sysclk_event.InvokeEarly();
+    SynchronizeSysClk();
 
   switch (cs.mode.sync_mode)
   {
@@ -198,7 +211,10 @@ void Timers::SetGate(u32 timer, bool state)
   }
 
   UpdateCountingEnabled(cs);
-  UpdateSysClkEvent();
+
+  // Counting changes only move the event if this timer can raise an IRQ.
+  if (HasIRQEnabled(cs))
+    UpdateSysClkEvent();
 }
 
 TickCount Timers::GetTicksUntilIRQ(u32 timer)
@@ -274,6 +290,26 @@ void Timers::CheckForIRQ(u32 timer, u32 old_counter)
 }
 
 void Timers::AddSysClkTicks(void*, TickCount sysclk_ticks, TickCount ticks_late)
+{
+  // Register accesses may have already advanced the counters for part of this time.
+  AddSysClkTicksToCounters(std::max<TickCount>(sysclk_ticks - s_state.sysclk_ticks_applied, 0));
+  s_state.sysclk_ticks_applied = 0;
+  UpdateSysClkEvent();
+}
+
+void Timers::SynchronizeSysClk()
+{
+  // The counters are advanced in place, rather than invoking the event early, which would have to re-sort the
+  // event queue on every register access. The event only needs to run when an IRQ is due.
+  const TickCount ticks = s_state.sysclk_event.GetTicksSinceLastExecution();
+  if (ticks <= s_state.sysclk_ticks_applied)
+    return;
+
+  AddSysClkTicksToCounters(ticks - s_state.sysclk_ticks_applied);
+  s_state.sysclk_ticks_applied = ticks;
+}
+
+void Timers::AddSysClkTicksToCounters(TickCount sysclk_ticks)
 {
   sysclk_ticks = System::UnscaleTicksToOverclock(sysclk_ticks, &s_state.sysclk_ticks_carry);
 
@@ -291,8 +327,6 @@ void Timers::AddSysClkTicks(void*, TickCount sysclk_ticks, TickCount ticks_late)
   {
     AddTicks(2, sysclk_ticks);
   }
-
-  UpdateSysClkEvent();
 }
 
 u32 Timers::ReadRegister(u32 offset)
@@ -318,7 +352,7 @@ u32 Timers::ReadRegister(u32 offset)
           g_gpu->SynchronizeCRTC();
       }
 
-      s_state.sysclk_event.InvokeEarly();
+      SynchronizeSysClk();
 
       return cs.counter;
     }
@@ -332,7 +366,7 @@ u32 Timers::ReadRegister(u32 offset)
           g_gpu->SynchronizeCRTC();
       }
 
-      s_state.sysclk_event.InvokeEarly();
+      SynchronizeSysClk();
 
       const u32 bits = cs.mode.bits;
       cs.mode.reached_overflow = false;
@@ -368,7 +402,7 @@ void Timers::WriteRegister(u32 offset, u32 value)
       g_gpu->SynchronizeCRTC();
   }
 
-  s_state.sysclk_event.InvokeEarly();
+  SynchronizeSysClk();
 
   // Strictly speaking these IRQ checks should probably happen on the next tick.
   switch (port_offset)
@@ -379,7 +413,7 @@ void Timers::WriteRegister(u32 offset, u32 value)
       DEBUG_LOG("Timer {} write counter {}", timer_index, value);
       cs.counter = value & u32(0xFFFF);
       CheckForIRQ(timer_index, old_counter);
-      if (timer_index == 2 || !cs.external_counting_enabled)
+      if ((timer_index == 2 || !cs.external_counting_enabled) && HasIRQEnabled(cs))
         UpdateSysClkEvent();
     }
     break;
@@ -407,7 +441,7 @@ void Timers::WriteRegister(u32 offset, u32 value)
       DEBUG_LOG("Timer {} write target 0x{:04X}", timer_index, ZeroExtend32(Truncate16(value)));
       cs.target = value & u32(0xFFFF);
       CheckForIRQ(timer_index, cs.counter);
-      if (timer_index == 2 || !cs.external_counting_enabled)
+      if ((timer_index == 2 || !cs.external_counting_enabled) && HasIRQEnabled(cs))
         UpdateSysClkEvent();
     }
     break;
@@ -449,17 +483,21 @@ void Timers::UpdateCountingEnabled(CounterState& cs)
   cs.external_counting_enabled = cs.use_external_clock && cs.counting_enabled;
 }
 
+bool Timers::HasIRQEnabled(const CounterState& cs)
+{
+  // A one-shot pulse IRQ can't fire again until the mode is rewritten.
+  return ((cs.mode.irq_at_target || cs.mode.irq_on_overflow) &&
+          (cs.mode.irq_repeat || cs.mode.irq_pulse_n || !cs.irq_done));
+}
+
 TickCount Timers::GetTicksUntilNextInterrupt()
 {
-  TickCount min_ticks = System::GetMaxSliceTicks();
+  TickCount min_ticks = std::numeric_limits<TickCount>::max();
   for (u32 i = 0; i < NUM_TIMERS; i++)
   {
     const CounterState& cs = s_state.counters[i];
-    if (!cs.counting_enabled || (i < 2 && cs.external_counting_enabled) ||
-        (!cs.mode.irq_at_target && !cs.mode.irq_on_overflow && (cs.mode.irq_repeat || !cs.irq_done)))
-    {
+    if (!cs.counting_enabled || (i < 2 && cs.external_counting_enabled) || !HasIRQEnabled(cs))
       continue;
-    }
 
     if (cs.mode.irq_at_target)
     {
@@ -480,6 +518,19 @@ TickCount Timers::GetTicksUntilNextInterrupt()
     }
   }
 
+  if (min_ticks == std::numeric_limits<TickCount>::max())
+  {
+    // Scaled so the elapsed sysclk ticks stay in range when underclocked, and capped so it can't overflow when
+    // overclocked. Can't use ScaleTicksToOverclock() directly, it truncates the result to TickCount.
+    if (!g_settings.cpu_overclock_active)
+      return IDLE_SYSCLK_EVENT_TICKS;
+
+    const u64 scaled_ticks = ((static_cast<u64>(IDLE_SYSCLK_EVENT_TICKS) * g_settings.cpu_overclock_numerator) +
+                              (g_settings.cpu_overclock_denominator - 1)) /
+                             g_settings.cpu_overclock_denominator;
+    return static_cast<TickCount>(std::min<u64>(scaled_ticks, static_cast<u64>(IDLE_SYSCLK_EVENT_TICKS)));
+  }
+
   return System::ScaleTicksToOverclock(std::max<TickCount>(1, min_ticks));
 }
 
@@ -253,6 +253,8 @@ void AdvancedSettingsWidget::addTweakOptions()
                         "RecompilerMemoryExceptions", false);
   addBooleanTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Enable Recompiler Block Linking"), "CPU",
                         "RecompilerBlockLinking", true);
+  addBooleanTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Enable Idle Loop Skipping"), "CPU", "IdleLoopSkipping",
+                        true);
   addChoiceTweakOption(m_dialog, m_ui.tweakOptionTable, tr("Enable Recompiler Fast Memory Access"), "CPU",
                        "FastmemMode", Settings::ParseCPUFastmemMode, Settings::GetCPUFastmemModeName,
                        Settings::GetCPUFastmemModeDisplayName, static_cast<u32>(CPUFastmemMode::Count),
@@ -299,6 +301,7 @@ void AdvancedSettingsWidget::onResetToDefaultClicked()
                            static_cast<int>(Settings::DEFAULT_GPU_MAX_RUN_AHEAD)); // GPU max run-ahead
     setBooleanTweakOption(m_ui.tweakOptionTable, i++, false);                      // Recompiler memory exceptions
     setBooleanTweakOption(m_ui.tweakOptionTable, i++, true);                       // Recompiler block linking
+    setBooleanTweakOption(m_ui.tweakOptionTable, i++, true);                       // Idle loop skipping
     setChoiceTweakOption(m_ui.tweakOptionTable, i++,
                          Settings::DEFAULT_CPU_FASTMEM_MODE); // Recompiler fastmem mode
     setChoiceTweakOption(m_ui.tweakOptionTable, i++,
@@ -332,6 +335,7 @@ void AdvancedSettingsWidget::onResetToDefaultClicked()
   sif->DeleteValue("Hacks", "ExportSharedMemory");
   sif->DeleteValue("CPU", "RecompilerMemoryExceptions");
   sif->DeleteValue("CPU", "RecompilerBlockLinking");
+  sif->DeleteValue("CPU", "IdleLoopSkipping");
   sif->DeleteValue("CPU", "FastmemMode");
   sif->DeleteValue("CDROM", "MechaconVersion");
   sif->DeleteValue("CDROM", "RegionCheck");
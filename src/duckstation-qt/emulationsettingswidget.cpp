@@ -16,12 +16,14 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
 
   m_ui.setupUi(this);
 
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.turboUncapped, "Main", "TurboUncapped", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.vsync, "Display", "VSync", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.syncToHostRefreshRate, "Main", "SyncToHostRefreshRate", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.optimalFramePacing, "Display", "OptimalFramePacing", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.preFrameSleep, "Display", "PreFrameSleep", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.skipPresentingDuplicateFrames, "Display",
                                                "SkipPresentingDuplicateFrames", false);
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.autoFrameSkip, "Display", "AutoFrameSkip", false);
   SettingWidgetBinder::BindWidgetToFloatSetting(sif, m_ui.preFrameSleepBuffer, "Display", "PreFrameSleepBuffer",
                                                 Settings::DEFAULT_DISPLAY_PRE_FRAME_SLEEP_BUFFER);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.rewindEnable, "Main", "RewindEnable", false);
@@ -99,6 +101,11 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
     m_ui.turboSpeed, tr("Turbo Speed"), tr("User Preference"),
     tr("Sets the turbo speed. This speed will be used when the turbo hotkey is pressed/toggled. Turboing will take "
        "priority over fast forwarding if both hotkeys are pressed/toggled."));
+  dialog->registerWidgetHelp(
+    m_ui.turboUncapped, tr("Uncapped Turbo"), tr("Unchecked"),
+    tr("When turbo is active, runs as fast as possible regardless of the turbo speed, with audio output disabled and "
+       "the display only updated once per second. The achieved speed is written to the log. Useful for skipping "
+       "through long sections, or automated runs."));
   dialog->registerWidgetHelp(
     m_ui.vsync, tr("Vertical Sync (VSync)"), tr("Unchecked"),
     tr("Synchronizes presentation of the console's frames to the host. Enabling may result in smoother animations, at "
@@ -130,6 +137,11 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
     tr("Skips the presentation/display of frames that are not unique. Can be combined with driver-level frame "
        "generation to increase perceptible frame rate. Can result in worse frame pacing, and is not compatible with "
        "syncing to host refresh."));
+  dialog->registerWidgetHelp(
+    m_ui.autoFrameSkip, tr("Automatic Frame Skip"), tr("Unchecked"),
+    tr("Skips rendering of frames when emulation falls behind the target speed, or when running unthrottled. At most "
+       "three frames in a row are skipped. Reduces slowdown on weaker hardware, at the cost of a less smooth display. "
+       "Not compatible with syncing to host refresh."));
   dialog->registerWidgetHelp(
     m_ui.rewindEnable, tr("Rewinding"), tr("Unchecked"),
     tr("<b>Enable Rewinding:</b> Saves state periodically so you can rewind any mistakes while playing.<br> "
@@ -229,6 +241,7 @@ void EmulationSettingsWidget::updateSkipDuplicateFramesEnabled()
   const bool vsync = m_dialog->getEffectiveBoolValue("Display", "VSync", false);
   const bool sync_to_host = m_dialog->getEffectiveBoolValue("Main", "SyncToHostRefreshRate", false) && vsync;
   m_ui.skipPresentingDuplicateFrames->setEnabled(!sync_to_host);
+  m_ui.autoFrameSkip->setEnabled(!sync_to_host);
 }
 
 void EmulationSettingsWidget::updateRewind()
@@ -8,6 +8,7 @@
 #include "settingswindow.h"
 
 #include "core/controller.h"
+#include "core/fingerprint_cache.h"
 #include "core/game_database.h"
 #include "core/game_list.h"
 
@@ -276,7 +277,12 @@ void GameSummaryWidget::populateTracksInfo()
                     .arg(((image->GetLBACount() * CDImage::RAW_SECTOR_SIZE) + 1048575) / 1048576)
                     .arg((image->GetSizeOnDisk() + 1048575) / 1048576));
 
+  // Show the hashes from last time if the image hasn't changed. They're still recomputed for verification.
   const u32 num_tracks = image->GetTrackCount();
+  std::vector<CDImageHasher::Hash> cached_hashes;
+  if (!FingerprintCache::GetTrackHashes(image.get(), &cached_hashes) || cached_hashes.size() != num_tracks)
+    cached_hashes.clear();
+
   for (u32 track = 1; track <= num_tracks; track++)
   {
     const CDImage::Position position = image->GetTrackStartMSFPosition(static_cast<u8>(track));
@@ -292,7 +298,10 @@ void GameSummaryWidget::populateTracksInfo()
     m_ui.tracks->setItem(row, 1, new QTableWidgetItem(track_mode_strings[static_cast<u32>(mode)]));
     m_ui.tracks->setItem(row, 2, new QTableWidgetItem(MSFTotString(position)));
     m_ui.tracks->setItem(row, 3, new QTableWidgetItem(MSFTotString(length)));
-    m_ui.tracks->setItem(row, 4, new QTableWidgetItem(tr("<not computed>")));
+    const QString hash_text = cached_hashes.empty() ?
+                                tr("<not computed>") :
+                                QString::fromStdString(CDImageHasher::HashToString(cached_hashes[row]));
+    m_ui.tracks->setItem(row, 4, new QTableWidgetItem(hash_text));
 
     QTableWidgetItem* status = new QTableWidgetItem(QString());
     status->setTextAlignment(Qt::AlignCenter);
@@ -401,7 +410,7 @@ void GameSummaryWidget::onComputeHashClicked()
   std::vector<CDImageHasher::Hash> track_hashes;
   track_hashes.reserve(image->GetTrackCount());
 
-  // Calculate hashes
+  // Always hash the image, since the point is to verify it. The result replaces any cached hashes.
   bool calculate_hash_success = true;
   for (u8 track = 1; track <= image->GetTrackCount(); track++)
   {
@@ -423,6 +432,9 @@ void GameSummaryWidget::onComputeHashClicked()
     progress_callback.PopState();
   }
 
+  if (calculate_hash_success)
+    FingerprintCache::SetTrackHashes(image.get(), track_hashes);
+
   // Verify hashes against gamedb
   std::vector<bool> verification_results(image->GetTrackCount(), false);
   if (calculate_hash_success)
@@ -119,6 +119,7 @@ GraphicsSettingsWidget::GraphicsSettingsWidget(SettingsWindow* dialog, QWidget*
                                                &Settings::ParseDisplayRotation, &Settings::GetDisplayRotationName,
                                                Settings::DEFAULT_DISPLAY_ROTATION);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.gpuThread, "GPU", "UseThread", true);
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.hardwareThread, "GPU", "UseHardwareThread", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.disableMailboxPresentation, "Display",
                                                "DisableMailboxPresentation", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.stretchDisplayVertically, "Display", "StretchVertically",
@@ -376,6 +377,10 @@ GraphicsSettingsWidget::GraphicsSettingsWidget(SettingsWindow* dialog, QWidget*
   dialog->registerWidgetHelp(m_ui.gpuThread, tr("Threaded Rendering"), tr("Checked"),
                              tr("Uses a second thread for drawing graphics. Currently only available for the software "
                                 "renderer, but can provide a significant speed improvement, and is safe to use."));
+  dialog->registerWidgetHelp(
+    m_ui.hardwareThread, tr("Threaded Hardware Rendering"), tr("Unchecked"),
+    tr("Batches and submits draws for the hardware renderers on a second thread. Not available with OpenGL. "
+       "Experimental, and may not be faster on all systems."));
   dialog->registerWidgetHelp(
     m_ui.disableMailboxPresentation, tr("Disable Mailbox Presentation"), tr("Unchecked"),
     tr("Forces the use of FIFO over Mailbox presentation, i.e. double buffering instead of triple buffering. "
@@ -772,6 +777,7 @@ void GraphicsSettingsWidget::updateRendererDependentOptions()
 #endif
 
   m_ui.gpuThread->setEnabled(!is_hardware);
+  m_ui.hardwareThread->setEnabled(is_hardware && render_api != RenderAPI::OpenGL && render_api != RenderAPI::OpenGLES);
 
   m_ui.exclusiveFullscreenLabel->setEnabled(render_api == RenderAPI::D3D11 || render_api == RenderAPI::D3D12 ||
                                             render_api == RenderAPI::Vulkan);
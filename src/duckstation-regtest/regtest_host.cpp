@@ -7,6 +7,8 @@
 #include "core/game_list.h"
 #include "core/gpu.h"
 #include "core/host.h"
+#include "core/input_movie.h"
+#include "core/spu.h"
 #include "core/system.h"
 
 #include "scmversion/scmversion.h"
@@ -53,6 +55,9 @@ static u32 s_frames_to_run = 60 * 60;
 static u32 s_frames_remaining = 0;
 static u32 s_frame_dump_interval = 0;
 static std::string s_dump_base_directory;
+static std::string s_input_movie_path;
+static std::string s_audio_dump_path;
+static bool s_input_movie_desynced = false;
 
 bool RegTestHost::SetFolders()
 {
@@ -362,6 +367,14 @@ void Host::ReleaseRenderWindow()
 
 void Host::FrameDone()
 {
+  const InputMovie* movie = System::GetInputMovie();
+  if (movie && movie->HasDesynced() && !s_input_movie_desynced)
+  {
+    ERROR_LOG("Input movie desynced at frame {} of {}, stopping.", movie->GetCurrentFrame(), movie->GetFrameCount());
+    s_input_movie_desynced = true;
+    System::ShutdownSystem(false);
+  }
+
   const u32 frame = System::GetFrameNumber();
   if (s_frame_dump_interval > 0 && (s_frame_dump_interval == 1 || (frame % s_frame_dump_interval) == 0))
   {
@@ -514,6 +527,8 @@ void RegTestHost::PrintCommandLineHelp(const char* progname)
   std::fprintf(stderr, "  -dumpdir: Set frame dump base directory (will be dumped to basedir/gametitle).\n");
   std::fprintf(stderr, "  -dumpinterval: Dumps every N frames.\n");
   std::fprintf(stderr, "  -frames: Sets the number of frames to execute.\n");
+  std::fprintf(stderr, "  -dumpaudio <file>: Writes the audio output to a WAV file.\n");
+  std::fprintf(stderr, "  -playback <movie>: Plays back an input movie, failing if emulation desyncs.\n");
   std::fprintf(stderr, "  -log <level>: Sets the log level. Defaults to verbose.\n");
   std::fprintf(stderr, "  -renderer <renderer>: Sets the graphics renderer. Default to software.\n");
   std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
@@ -583,6 +598,28 @@ bool RegTestHost::ParseCommandLineParameters(int argc, char* argv[], std::option
 
         continue;
       }
+      else if (CHECK_ARG_PARAM("-dumpaudio"))
+      {
+        s_audio_dump_path = argv[++i];
+        if (s_audio_dump_path.empty())
+        {
+          ERROR_LOG("Invalid audio dump path specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-playback"))
+      {
+        s_input_movie_path = argv[++i];
+        if (s_input_movie_path.empty())
+        {
+          ERROR_LOG("Invalid input movie specified.");
+          return false;
+        }
+
+        continue;
+      }
       else if (CHECK_ARG_PARAM("-log"))
       {
         std::optional<LOGLEVEL> level = Settings::ParseLogLevelName(argv[++i]);
@@ -779,6 +816,26 @@ int main(int argc, char* argv[])
     INFO_LOG("Dumping every {}th frame to '{}'.", s_frame_dump_interval, s_dump_base_directory);
   }
 
+  if (!s_audio_dump_path.empty() && !SPU::StartDumpingAudio(s_audio_dump_path.c_str()))
+    goto cleanup;
+
+  if (!s_input_movie_path.empty())
+  {
+    if (!System::StartInputMoviePlayback(s_input_movie_path.c_str(), &error))
+    {
+      ERROR_LOG("Failed to start input movie playback: {}", error.GetDescription());
+      goto cleanup;
+    }
+
+    // Run exactly the length of the movie, so every frame hash is checked.
+    s_frames_to_run = System::GetInputMovie()->GetFrameCount();
+    if (s_frames_to_run == 0)
+    {
+      ERROR_LOG("Input movie contains no frames.");
+      goto cleanup;
+    }
+  }
+
   INFO_LOG("Running for {} frames...", s_frames_to_run);
   s_frames_remaining = s_frames_to_run;
 
@@ -794,6 +851,12 @@ int main(int argc, char* argv[])
              static_cast<double>(s_frames_to_run) / elapsed_time_ms * 1000.0);
   }
 
+  if (s_input_movie_desynced)
+  {
+    ERROR_LOG("Exiting with failure due to input movie desync.");
+    goto cleanup;
+  }
+
   INFO_LOG("Exiting with success.");
   result = 0;
 
@@ -418,6 +418,11 @@ s64 CDImage::GetSizeOnDisk() const
   return -1;
 }
 
+std::vector<std::string> CDImage::GetSourceFiles() const
+{
+  return {m_filename};
+}
+
 void CDImage::ClearTOC()
 {
   m_lba_count = 0;
@@ -336,6 +336,9 @@ public:
   // If this function returns -1, it means the size could not be computed.
   virtual s64 GetSizeOnDisk() const;
 
+  // Returns the files which the image data is read from, including any patches applied on top.
+  virtual std::vector<std::string> GetSourceFiles() const;
+
 protected:
   void ClearTOC();
   void CopyTOC(const CDImage* image);
@@ -3,6 +3,7 @@
 
 #include "cd_image.h"
 #include "cd_subchannel_replacement.h"
+#include "memory_usage.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -100,7 +101,12 @@ CDImageCHD::CDImageCHD() = default;
 CDImageCHD::~CDImageCHD()
 {
   if (m_chd)
+  {
+    if (m_precached)
+      MemoryUsage::Remove(MemoryUsage::Category::CDImagePrecache, static_cast<s64>(chd_get_compressed_size(m_chd)));
+
     chd_close(m_chd);
+  }
 }
 
 chd_file* CDImageCHD::OpenCHD(std::string_view filename, FileSystem::ManagedCFilePtr fp, Error* error,
@@ -469,6 +475,7 @@ CDImage::PrecacheResult CDImageCHD::Precache(ProgressCallback* progress)
     return CDImage::PrecacheResult::ReadError;
 
   m_precached = true;
+  MemoryUsage::Add(MemoryUsage::Category::CDImagePrecache, static_cast<s64>(chd_get_compressed_size(m_chd)));
   return CDImage::PrecacheResult::Success;
 }
 
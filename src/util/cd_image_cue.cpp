@@ -32,6 +32,7 @@ public:
   bool ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index) override;
   bool HasNonStandardSubchannel() const override;
   s64 GetSizeOnDisk() const override;
+  std::vector<std::string> GetSourceFiles() const override;
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
@@ -40,6 +41,7 @@ private:
   struct TrackFile
   {
     std::string filename;
+    std::string path;
     std::FILE* file;
     u64 file_position;
   };
@@ -101,7 +103,8 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
       const std::string track_full_filename(
         !Path::IsAbsolute(track_filename) ? Path::BuildRelativePath(m_filename, track_filename) : track_filename);
       Error track_error;
-      std::FILE* track_fp = FileSystem::OpenCFile(track_full_filename.c_str(), "rb", &track_error);
+      std::string track_path = track_full_filename;
+      std::FILE* track_fp = FileSystem::OpenCFile(track_path.c_str(), "rb", &track_error);
       if (!track_fp && track_file_index == 0)
       {
         // many users have bad cuesheets, or they're renamed the files without updating the cuesheet.
@@ -110,6 +113,7 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
         track_fp = FileSystem::OpenCFile(alternative_filename.c_str(), "rb");
         if (track_fp)
         {
+          track_path = alternative_filename;
           WARNING_LOG("Your cue sheet references an invalid file '{}', but this was found at '{}' instead.",
                       track_filename, alternative_filename);
         }
@@ -124,7 +128,7 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
         return false;
       }
 
-      m_files.push_back(TrackFile{track_filename, track_fp, 0});
+      m_files.push_back(TrackFile{track_filename, std::move(track_path), track_fp, 0});
     }
 
     // data type determines the sector size
@@ -344,6 +348,16 @@ s64 CDImageCueSheet::GetSizeOnDisk() const
   return size;
 }
 
+std::vector<std::string> CDImageCueSheet::GetSourceFiles() const
+{
+  std::vector<std::string> ret;
+  ret.reserve(m_files.size() + 1);
+  ret.push_back(m_filename);
+  for (const TrackFile& tf : m_files)
+    ret.push_back(tf.path);
+  return ret;
+}
+
 std::unique_ptr<CDImage> CDImage::OpenCueSheetImage(const char* filename, Error* error)
 {
   std::unique_ptr<CDImageCueSheet> image = std::make_unique<CDImageCueSheet>();
@@ -35,6 +35,7 @@ public:
   u32 GetCurrentSubImage() const override;
   std::string GetSubImageMetadata(u32 index, std::string_view type) const override;
   bool SwitchSubImage(u32 index, Error* error) override;
+  std::vector<std::string> GetSourceFiles() const override;
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
@@ -159,6 +160,13 @@ bool CDImageM3u::SwitchSubImage(u32 index, Error* error)
   return true;
 }
 
+std::vector<std::string> CDImageM3u::GetSourceFiles() const
+{
+  std::vector<std::string> ret = m_current_image->GetSourceFiles();
+  ret.insert(ret.begin(), m_filename);
+  return ret;
+}
+
 std::string CDImageM3u::GetSubImageMetadata(u32 index, std::string_view type) const
 {
   if (index >= m_entries.size())
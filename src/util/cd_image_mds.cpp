@@ -49,6 +49,7 @@ public:
   bool ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index) override;
   bool HasNonStandardSubchannel() const override;
   s64 GetSizeOnDisk() const override;
+  std::vector<std::string> GetSourceFiles() const override;
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
@@ -289,6 +290,11 @@ s64 CDImageMds::GetSizeOnDisk() const
   return FileSystem::FSize64(m_mdf_file);
 }
 
+std::vector<std::string> CDImageMds::GetSourceFiles() const
+{
+  return {m_filename, Path::ReplaceExtension(m_filename, "mdf")};
+}
+
 std::unique_ptr<CDImage> CDImage::OpenMdsImage(const char* filename, Error* error)
 {
   std::unique_ptr<CDImageMds> image = std::make_unique<CDImageMds>();
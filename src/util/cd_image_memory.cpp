@@ -3,6 +3,7 @@
 
 #include "cd_image.h"
 #include "cd_subchannel_replacement.h"
+#include "memory_usage.h"
 
 #include "common/assert.h"
 #include "common/file_system.h"
@@ -28,6 +29,7 @@ public:
   bool HasNonStandardSubchannel() const override;
 
   bool IsPrecached() const override;
+  std::vector<std::string> GetSourceFiles() const override;
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
@@ -36,6 +38,7 @@ private:
   u8* m_memory = nullptr;
   u32 m_memory_sectors = 0;
   CDSubChannelReplacement m_sbi;
+  std::vector<std::string> m_source_files;
 };
 
 } // namespace
@@ -45,7 +48,11 @@ CDImageMemory::CDImageMemory() = default;
 CDImageMemory::~CDImageMemory()
 {
   if (m_memory)
+  {
     std::free(m_memory);
+    MemoryUsage::Remove(MemoryUsage::Category::CDImagePrecache,
+                        static_cast<s64>(RAW_SECTOR_SIZE) * static_cast<s64>(m_memory_sectors));
+  }
 }
 
 bool CDImageMemory::CopyImage(CDImage* image, ProgressCallback* progress)
@@ -76,6 +83,9 @@ bool CDImageMemory::CopyImage(CDImage* image, ProgressCallback* progress)
     return false;
   }
 
+  MemoryUsage::Add(MemoryUsage::Category::CDImagePrecache,
+                   static_cast<s64>(RAW_SECTOR_SIZE) * static_cast<s64>(m_memory_sectors));
+
   progress->SetStatusText("Preloading CD image to RAM...");
   progress->SetProgressRange(m_memory_sectors);
   progress->SetProgressValue(0);
@@ -120,6 +130,7 @@ bool CDImageMemory::CopyImage(CDImage* image, ProgressCallback* progress)
 
   Assert(current_offset == m_memory_sectors);
   m_filename = image->GetFileName();
+  m_source_files = image->GetSourceFiles();
   m_lba_count = image->GetLBACount();
 
   m_sbi.LoadFromImagePath(m_filename);
@@ -145,6 +156,11 @@ bool CDImageMemory::IsPrecached() const
   return true;
 }
 
+std::vector<std::string> CDImageMemory::GetSourceFiles() const
+{
+  return m_source_files;
+}
+
 bool CDImageMemory::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index)
 {
   DebugAssert(index.file_index == 0);
@@ -35,6 +35,7 @@ public:
   bool ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index) override;
   bool HasNonStandardSubchannel() const override;
   s64 GetSizeOnDisk() const override;
+  std::vector<std::string> GetSourceFiles() const override;
 
   std::string GetMetadata(std::string_view type) const override;
   std::string GetSubImageMetadata(u32 index, std::string_view type) const override;
@@ -55,6 +56,7 @@ private:
   std::unique_ptr<CDImage> m_parent_image;
   std::vector<u8> m_replacement_data;
   std::unordered_map<u32, u32> m_replacement_map;
+  std::string m_patch_filename;
   s64 m_patch_size = 0;
   u32 m_replacement_offset = 0;
 };
@@ -74,6 +76,7 @@ bool CDImagePPF::Open(const char* filename, std::unique_ptr<CDImage> parent_imag
     return false;
   }
 
+  m_patch_filename = filename;
   m_patch_size = FileSystem::FSize64(fp.get());
 
   u32 magic;
@@ -459,6 +462,13 @@ s64 CDImagePPF::GetSizeOnDisk() const
   return m_patch_size + m_parent_image->GetSizeOnDisk();
 }
 
+std::vector<std::string> CDImagePPF::GetSourceFiles() const
+{
+  std::vector<std::string> ret = m_parent_image->GetSourceFiles();
+  ret.push_back(m_patch_filename);
+  return ret;
+}
+
 std::unique_ptr<CDImage>
 CDImage::OverlayPPFPatch(const char* filename, std::unique_ptr<CDImage> parent_image,
                          ProgressCallback* progress /* = ProgressCallback::NullProgressCallback */)
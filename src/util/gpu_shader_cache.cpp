@@ -3,6 +3,7 @@
 
 #include "gpu_shader_cache.h"
 #include "gpu_device.h"
+#include "memory_usage.h"
 
 #include "common/error.h"
 #include "common/file_system.h"
@@ -47,6 +48,9 @@ GPUShaderCache::GPUShaderCache() = default;
 GPUShaderCache::~GPUShaderCache()
 {
   Close();
+
+  m_index.clear();
+  UpdateMemoryUsage();
 }
 
 bool GPUShaderCache::CacheIndexKey::operator==(const CacheIndexKey& key) const
@@ -210,6 +214,7 @@ bool GPUShaderCache::ReadExisting(const std::string& index_filename, const std::
 
       ERROR_LOG("Failed to read entry from '{}', corrupt file?", Path::GetFileName(index_filename));
       m_index.clear();
+      UpdateMemoryUsage();
       std::fclose(m_blob_file);
       m_blob_file = nullptr;
       std::fclose(m_index_file);
@@ -228,9 +233,18 @@ bool GPUShaderCache::ReadExisting(const std::string& index_filename, const std::
   std::fseek(m_index_file, 0, SEEK_END);
 
   DEV_LOG("Read {} entries from '{}'", m_index.size(), Path::GetFileName(index_filename));
+  UpdateMemoryUsage();
   return true;
 }
 
+void GPUShaderCache::UpdateMemoryUsage()
+{
+  // Only the index stays in memory, binaries are read from the blob file when they're used.
+  const size_t usage = m_index.size() * (sizeof(CacheIndex::value_type) + sizeof(void*) * 2);
+  MemoryUsage::Add(MemoryUsage::Category::ShaderCache, static_cast<s64>(usage) - static_cast<s64>(m_memory_usage));
+  m_memory_usage = usage;
+}
+
 GPUShaderCache::CacheIndexKey GPUShaderCache::GetCacheKey(GPUShaderStage stage, GPUShaderLanguage language,
                                                           std::string_view shader_code, std::string_view entry_point)
 {
@@ -336,5 +350,6 @@ bool GPUShaderCache::Insert(const CacheIndexKey& key, const void* data, u32 data
   DEV_LOG("Cached compressed {} shader: {} -> {} bytes",
           GPUShader::GetStageName(static_cast<GPUShaderStage>(key.shader_type)), data_size, compress_buffer->size());
   m_index.emplace(key, idata);
+  UpdateMemoryUsage();
   return true;
 }
@@ -73,8 +73,10 @@ private:
 
   bool CreateNew(const std::string& index_filename, const std::string& blob_filename);
   bool ReadExisting(const std::string& index_filename, const std::string& blob_filename);
+  void UpdateMemoryUsage();
 
   CacheIndex m_index;
+  size_t m_memory_usage = 0;
 
   std::string m_base_filename;
   u32 m_render_api_version = 0;
@@ -3,6 +3,7 @@
 
 #include "gpu_texture.h"
 #include "gpu_device.h"
+#include "memory_usage.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -17,11 +18,13 @@ GPUTexture::GPUTexture(u16 width, u16 height, u8 layers, u8 levels, u8 samples,
     m_format(format)
 {
   GPUDevice::s_total_vram_usage += GetVRAMUsage();
+  MemoryUsage::Add(MemoryUsage::Category::GPUTextures, static_cast<s64>(GetVRAMUsage()));
 }
 
 GPUTexture::~GPUTexture()
 {
   GPUDevice::s_total_vram_usage -= GetVRAMUsage();
+  MemoryUsage::Remove(MemoryUsage::Category::GPUTextures, static_cast<s64>(GetVRAMUsage()));
 }
 
 const char* GPUTexture::GetFormatName(Format format)
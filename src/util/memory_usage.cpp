@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#include "memory_usage.h"
+
+#include "common/assert.h"
+#include "common/log.h"
+#include "common/small_string.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+Log_SetChannel(MemoryUsage);
+
+namespace MemoryUsage {
+namespace {
+struct CategoryState
+{
+  std::atomic<s64> current{0};
+  std::atomic<s64> peak{0};
+  std::atomic<size_t> budget{0};
+};
+} // namespace
+
+static constexpr u32 NUM_CATEGORIES = static_cast<u32>(Category::Count);
+
+static constexpr std::array<const char*, NUM_CATEGORIES> s_category_names = {{
+  "CPU Code Buffer",
+  "PGXP",
+  "Rewind States",
+  "Runahead States",
+  "Texture Replacements",
+  "CD Image Precache",
+  "Shader Cache",
+  "GPU Textures",
+}};
+
+static std::array<CategoryState, NUM_CATEGORIES> s_categories;
+static std::atomic<s64> s_total_peak{0};
+
+static void UpdatePeak(std::atomic<s64>& peak, s64 value);
+static bool IsHostCategory(Category category);
+} // namespace MemoryUsage
+
+bool MemoryUsage::IsHostCategory(Category category)
+{
+  return (category != Category::GPUTextures);
+}
+
+void MemoryUsage::UpdatePeak(std::atomic<s64>& peak, s64 value)
+{
+  s64 prev = peak.load(std::memory_order_relaxed);
+  while (value > prev && !peak.compare_exchange_weak(prev, value, std::memory_order_relaxed))
+    ;
+}
+
+const char* MemoryUsage::GetCategoryName(Category category)
+{
+  return s_category_names[static_cast<u32>(category)];
+}
+
+void MemoryUsage::Add(Category category, s64 bytes)
+{
+  CategoryState& cs = s_categories[static_cast<u32>(category)];
+  const s64 value = cs.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  DebugAssert(value >= 0);
+  if (bytes > 0)
+  {
+    UpdatePeak(cs.peak, value);
+    if (IsHostCategory(category))
+      UpdatePeak(s_total_peak, static_cast<s64>(GetTotalCurrent()));
+  }
+}
+
+void MemoryUsage::Set(Category category, size_t bytes)
+{
+  CategoryState& cs = s_categories[static_cast<u32>(category)];
+  const s64 value = static_cast<s64>(bytes);
+  if (cs.current.exchange(value, std::memory_order_relaxed) < value)
+  {
+    UpdatePeak(cs.peak, value);
+    if (IsHostCategory(category))
+      UpdatePeak(s_total_peak, static_cast<s64>(GetTotalCurrent()));
+  }
+}
+
+size_t MemoryUsage::GetCurrent(Category category)
+{
+  return static_cast<size_t>(std::max<s64>(s_categories[static_cast<u32>(category)].current.load(), 0));
+}
+
+size_t MemoryUsage::GetPeak(Category category)
+{
+  return static_cast<size_t>(s_categories[static_cast<u32>(category)].peak.load());
+}
+
+size_t MemoryUsage::GetTotalCurrent()
+{
+  size_t total = 0;
+  for (u32 i = 0; i < NUM_CATEGORIES; i++)
+  {
+    if (IsHostCategory(static_cast<Category>(i)))
+      total += GetCurrent(static_cast<Category>(i));
+  }
+  return total;
+}
+
+size_t MemoryUsage::GetTotalPeak()
+{
+  return static_cast<size_t>(s_total_peak.load());
+}
+
+void MemoryUsage::ResetPeaks()
+{
+  for (CategoryState& cs : s_categories)
+    cs.peak.store(cs.current.load());
+  s_total_peak.store(static_cast<s64>(GetTotalCurrent()));
+}
+
+void MemoryUsage::SetBudget(Category category, size_t bytes)
+{
+  s_categories[static_cast<u32>(category)].budget.store(bytes);
+}
+
+size_t MemoryUsage::GetBudget(Category category)
+{
+  return s_categories[static_cast<u32>(category)].budget.load();
+}
+
+bool MemoryUsage::WouldExceedBudget(Category category, size_t additional_bytes)
+{
+  const size_t budget = GetBudget(category);
+  return (budget > 0 && (GetCurrent(category) + additional_bytes) > budget);
+}
+
+void MemoryUsage::FormatSummary(SmallStringBase& str)
+{
+  str.format("Host Memory: {:.1f} MB (Peak {:.1f} MB) | GPU Textures: {:.1f} MB",
+             static_cast<double>(GetTotalCurrent()) / 1048576.0, static_cast<double>(GetTotalPeak()) / 1048576.0,
+             static_cast<double>(GetCurrent(Category::GPUTextures)) / 1048576.0);
+}
+
+void MemoryUsage::LogReport()
+{
+  INFO_LOG("Host memory usage:");
+  for (u32 i = 0; i < NUM_CATEGORIES; i++)
+  {
+    const Category category = static_cast<Category>(i);
+    if (!IsHostCategory(category))
+      continue;
+
+    const size_t budget = GetBudget(category);
+    if (budget > 0)
+    {
+      INFO_LOG("  {:<22} {:9.2f} MB, peak {:9.2f} MB, budget {:9.2f} MB", GetCategoryName(category),
+               static_cast<double>(GetCurrent(category)) / 1048576.0, static_cast<double>(GetPeak(category)) / 1048576.0,
+               static_cast<double>(budget) / 1048576.0);
+    }
+    else
+    {
+      INFO_LOG("  {:<22} {:9.2f} MB, peak {:9.2f} MB", GetCategoryName(category),
+               static_cast<double>(GetCurrent(category)) / 1048576.0, static_cast<double>(GetPeak(category)) / 1048576.0);
+    }
+  }
+
+  INFO_LOG("  {:<22} {:9.2f} MB, peak {:9.2f} MB", "Host Total", static_cast<double>(GetTotalCurrent()) / 1048576.0,
+           static_cast<double>(GetTotalPeak()) / 1048576.0);
+
+  INFO_LOG("Device memory usage:");
+  INFO_LOG("  {:<22} {:9.2f} MB, peak {:9.2f} MB", GetCategoryName(Category::GPUTextures),
+           static_cast<double>(GetCurrent(Category::GPUTextures)) / 1048576.0,
+           static_cast<double>(GetPeak(Category::GPUTextures)) / 1048576.0);
+}
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: CC-BY-NC-ND-4.0
+
+#pragma once
+
+#include "common/types.h"
+
+class SmallStringBase;
+
+/// Accounting of host memory used by the larger allocations in the emulator. Each subsystem reports changes to its
+/// usage, and the peak is tracked automatically. Budgets are optional, and only honoured by caches which can evict.
+namespace MemoryUsage {
+
+enum class Category : u8
+{
+  CPUCodeBuffer,
+  PGXP,
+  RewindStates,
+  RunaheadStates,
+  TextureReplacements,
+  CDImagePrecache,
+  ShaderCache,
+  GPUTextures, // Device memory, not included in the host totals.
+
+  Count
+};
+
+const char* GetCategoryName(Category category);
+
+/// Adjusts the usage of a category. Safe to call from any thread.
+void Add(Category category, s64 bytes);
+ALWAYS_INLINE void Remove(Category category, s64 bytes) { Add(category, -bytes); }
+
+/// Replaces the usage of a category, for subsystems which recompute their total.
+void Set(Category category, size_t bytes);
+
+size_t GetCurrent(Category category);
+size_t GetPeak(Category category);
+
+/// Totals only include host memory categories.
+size_t GetTotalCurrent();
+size_t GetTotalPeak();
+void ResetPeaks();
+
+/// Sets the budget for a category in bytes, zero for unlimited.
+void SetBudget(Category category, size_t bytes);
+size_t GetBudget(Category category);
+
+/// Returns true if adding the specified number of bytes would take the category over its budget.
+bool WouldExceedBudget(Category category, size_t additional_bytes);
+
+/// Single line summary of the total, for the performance overlay.
+void FormatSummary(SmallStringBase& str);
+
+/// Writes current and peak usage for each category to the log.
+void LogReport();
+
+} // namespace MemoryUsage
@@ -19,6 +19,13 @@ StateWrapper::StateWrapper(std::span<const u8> data, Mode mode, u32 version)
   Assert(mode == Mode::Read);
 }
 
+StateWrapper::StateWrapper(std::span<u8> chunk_buffer, FlushCallback flush_callback, u32 version)
+  : m_data(chunk_buffer.data()), m_size(chunk_buffer.size()), m_flush_callback(std::move(flush_callback)),
+    m_mode(Mode::Write), m_version(version)
+{
+  Assert(m_size > 0 && m_flush_callback);
+}
+
 StateWrapper::~StateWrapper() = default;
 
 void StateWrapper::DoBytes(void* data, size_t length)
@@ -56,8 +63,8 @@ void StateWrapper::Do(bool* value_ptr)
   }
   else
   {
-    if (!(m_error = m_error || (m_pos + 1) > m_size)) [[likely]]
-      m_data[m_pos++] = static_cast<u8>(*value_ptr);
+    const u8 value = static_cast<u8>(*value_ptr);
+    WriteData(&value, sizeof(value));
   }
 }
 
@@ -107,7 +114,7 @@ bool StateWrapper::DoMarker(const char* marker)
   if (m_mode == Mode::Write || file_value.equals(marker))
     return true;
 
-  ERROR_LOG("Marker mismatch at offset {}: found '{}' expected '{}'", m_pos, file_value, marker);
+  ERROR_LOG("Marker mismatch at offset {}: found '{}' expected '{}'", GetPosition(), file_value, marker);
   return false;
 }
 
@@ -123,10 +130,56 @@ bool StateWrapper::ReadData(void* buf, size_t size)
 
 bool StateWrapper::WriteData(const void* buf, size_t size)
 {
-  if ((m_error = (m_error || (m_pos + size) > m_size))) [[unlikely]]
-    return false;
+  if ((m_pos + size) > m_size || m_error) [[unlikely]]
+    return StreamData(buf, size);
 
   std::memcpy(&m_data[m_pos], buf, size);
   m_pos += size;
   return true;
 }
+
+bool StateWrapper::StreamData(const void* buf, size_t size)
+{
+  if (m_error || !m_flush_callback || !Flush())
+  {
+    m_error = true;
+    return false;
+  }
+
+  // Large blocks such as RAM/VRAM skip the chunk buffer entirely.
+  if (size >= m_size)
+  {
+    if (!m_flush_callback(std::span<const u8>(static_cast<const u8*>(buf), size))) [[unlikely]]
+    {
+      m_error = true;
+      return false;
+    }
+
+    m_flushed_size += size;
+    return true;
+  }
+
+  std::memcpy(m_data, buf, size);
+  m_pos = size;
+  return true;
+}
+
+bool StateWrapper::Flush()
+{
+  DebugAssert(m_mode == Mode::Write);
+  if (m_error)
+    return false;
+
+  if (m_pos == 0 || !m_flush_callback)
+    return true;
+
+  if (!m_flush_callback(std::span<const u8>(m_data, m_pos))) [[unlikely]]
+  {
+    m_error = true;
+    return false;
+  }
+
+  m_flushed_size += m_pos;
+  m_pos = 0;
+  return true;
+}
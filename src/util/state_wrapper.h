@@ -9,6 +9,7 @@
 
 #include <cstring>
 #include <deque>
+#include <functional>
 #include <string>
 #include <span>
 #include <type_traits>
@@ -25,16 +26,28 @@ public:
     Write
   };
 
+  /// Receives buffered data from a streaming wrapper. Returning false puts the wrapper into the error state.
+  using FlushCallback = std::function<bool(std::span<const u8>)>;
+
   StateWrapper(std::span<u8> data, Mode mode, u32 version);
   StateWrapper(std::span<const u8> data, Mode mode, u32 version);
+
+  /// Creates a streaming writer. Data is batched into the chunk buffer, and passed to the callback when it fills.
+  /// Writes larger than the chunk buffer bypass it and are passed to the callback directly.
+  StateWrapper(std::span<u8> chunk_buffer, FlushCallback flush_callback, u32 version);
+
   StateWrapper(const StateWrapper&) = delete;
   ~StateWrapper();
 
   ALWAYS_INLINE bool HasError() const { return m_error; }
   ALWAYS_INLINE bool IsReading() const { return (m_mode == Mode::Read); }
   ALWAYS_INLINE bool IsWriting() const { return (m_mode == Mode::Write); }
+  ALWAYS_INLINE bool IsStreaming() const { return static_cast<bool>(m_flush_callback); }
   ALWAYS_INLINE u32 GetVersion() const { return m_version; }
-  ALWAYS_INLINE size_t GetPosition() const { return m_pos; }
+  ALWAYS_INLINE size_t GetPosition() const { return m_flushed_size + m_pos; }
+
+  /// Passes any buffered data to the flush callback. Must be called after the last write when streaming.
+  bool Flush();
 
   /// Overload for integral or floating-point types. Writes bytes as-is.
   template<typename T, std::enable_if_t<std::is_integral_v<T> || std::is_floating_point_v<T>, int> = 0>
@@ -89,15 +102,23 @@ public:
   template<typename T>
   void DoArray(T* values, size_t count)
   {
-    for (size_t i = 0; i < count; i++)
-      Do(&values[i]);
+    // Integers and floats are stored as-is, so contiguous arrays can be transferred in one go.
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    {
+      DoBytes(values, sizeof(T) * count);
+    }
+    else
+    {
+      for (size_t i = 0; i < count; i++)
+        Do(&values[i]);
+    }
   }
 
   template<typename T>
   void DoPODArray(T* values, size_t count)
   {
-    for (size_t i = 0; i < count; i++)
-      DoPOD(&values[i]);
+    static_assert(std::is_standard_layout_v<T> && std::is_trivial_v<T>);
+    DoBytes(values, sizeof(T) * count);
   }
 
   void DoBytes(void* data, size_t length);
@@ -148,7 +169,7 @@ public:
     else
     {
       for (u32 i = 0; i < length; i++)
-        Do(&data[i]);
+        Do(&(*data)[i]);
     }
   }
 
@@ -206,10 +227,13 @@ public:
 private:
   bool ReadData(void* buf, size_t size);
   bool WriteData(const void* buf, size_t size);
+  bool StreamData(const void* buf, size_t size);
 
   u8* m_data;
   size_t m_size;
   size_t m_pos = 0;
+  size_t m_flushed_size = 0;
+  FlushCallback m_flush_callback;
   Mode m_mode;
   u32 m_version;
   bool m_error = false;